@@ -3,8 +3,18 @@
 
 
 #include <cstdint>
+#include <iterator>
+#include <type_traits>
 #include <vector>
 
+// Define ERC_BINTREE_PARALLEL before including this header to enable the multi-threaded construction and traversals,
+// which need <thread> and ParallelThreads.hpp.
+#ifdef ERC_BINTREE_PARALLEL
+#include <atomic>
+#include <thread>
+#include "ParallelThreads.hpp"
+#endif
+
 //! Contains an implementation of a Binary Tree system, utility functions, and traversal functions.
 namespace BinTree {
 /********!
@@ -20,6 +30,9 @@ template<typename NodeData> struct c_BinaryNode {
 	c_BinaryNode* child_L, *child_R;
 	NodeData nodeData;
 	uint32_t index;
+	//! Number of nodes and height of the subtree rooted here, which are only kept up to date by a c_BinaryTree that has
+	//! its stat caching enabled (see c_BinaryTree::setStatCaching).
+	uint32_t subtreeSize = 1, subtreeHeight = 1;
 	
 	//! Construct the node with just an ID and a value. Both child nodes will be set to nullptr.
 	c_BinaryNode(uint32_t id, const NodeData val) : child_L(nullptr), child_R(nullptr) {nodeData = val; index = id;}
@@ -33,19 +46,62 @@ template<typename NodeData> struct c_BinaryNode {
 			if (child_R == nullptr) return 1; else return 2;
 		}
 	}
+	//! Calculates both the depth of the binary tree as judged from this node and the number of nodes in it (including this
+	//! one) in a single iterative pass, so that even a degenerate, chain-like tree cannot overflow the call stack.
+	void determineStats(uint32_t& depth, uint32_t& descendants) const {
+		struct c_Frame {
+			const c_BinaryNode* node;
+			uint32_t depth;
+		};
+		std::vector<c_Frame> stack = {{this, 1}};
+		depth = 0;
+		descendants = 0;
+		while (!stack.empty()) {
+			const c_Frame frame = stack.back();
+			stack.pop_back();
+			descendants++;
+			if (frame.depth > depth) depth = frame.depth;
+			if (frame.node->child_R != nullptr) stack.push_back({frame.node->child_R, frame.depth + 1});
+			if (frame.node->child_L != nullptr) stack.push_back({frame.node->child_L, frame.depth + 1});
+		}
+	}
 	//! Returns the depth of the binary tree as judged from this node.
-	uint32_t determineDepth() const noexcept {
-		uint32_t dL = 0, dR = 0;
-		if (this->child_L != nullptr) {dL = this->child_L->determineDepth();}
-		if (this->child_R != nullptr) {dR = this->child_R->determineDepth();}
-		return 1 + ((dL > dR) ? dL : dR);
+	uint32_t determineDepth() const {
+		uint32_t depth, descendants;
+		this->determineStats(depth, descendants);
+		return depth;
 	}
 	//! Returns the number of children this node has.
-	uint32_t determineDescendants() const noexcept {
-		uint32_t dL = 0, dR = 0;
-		if (this->child_L != nullptr) {dL = this->child_L->determineDescendants();}
-		if (this->child_R != nullptr) {dR = this->child_R->determineDescendants();}
-		return 1 + dL + dR;
+	uint32_t determineDescendants() const {
+		uint32_t depth, descendants;
+		this->determineStats(depth, descendants);
+		return descendants;
+	}
+	//! Sets @c subtreeSize and @c subtreeHeight for this node and every node below it, in one iterative post-order pass.
+	void cacheSubtreeStats() {
+		struct c_Frame {
+			c_BinaryNode* node;
+			bool expanded;
+		};
+		std::vector<c_Frame> stack = {{this, false}};
+		while (!stack.empty()) {
+			c_BinaryNode* node = stack.back().node;
+			if (!stack.back().expanded) {
+				stack.back().expanded = true;
+				if (node->child_R != nullptr) stack.push_back({node->child_R, false});
+				if (node->child_L != nullptr) stack.push_back({node->child_L, false});
+				continue;
+			}
+			stack.pop_back();
+			node->refreshSubtreeStats();
+		}
+	}
+	//! Recalculates @c subtreeSize and @c subtreeHeight for this node alone, from the cached values of its children.
+	void refreshSubtreeStats() noexcept {
+		const uint32_t sL = (this->child_L != nullptr) ? this->child_L->subtreeSize : 0, sR = (this->child_R != nullptr) ? this->child_R->subtreeSize : 0;
+		const uint32_t hL = (this->child_L != nullptr) ? this->child_L->subtreeHeight : 0, hR = (this->child_R != nullptr) ? this->child_R->subtreeHeight : 0;
+		this->subtreeSize = 1 + sL + sR;
+		this->subtreeHeight = 1 + ((hL > hR) ? hL : hR);
 	}
 	
 	/********!
@@ -91,39 +147,177 @@ template<typename NodeData> struct c_BinaryNode {
 
 /********!
  * @brief
- *  	Performs a Recursive Ordered Traversal from the specified Binary Node. Can operate in In-Order or in Reverse In-Order.
+ *  	Performs an Iterative Ordered Traversal from the specified Binary Node, handing each node to a visitor as it is reached
+ *  	instead of collecting them. Can operate in In-Order or in Reverse In-Order. The nodes still to be visited are held on
+ *  	an explicit stack, so the depth of the tree is not limited by the call stack.
  * @param [in] what
  *  	Node to begin the traversal from. Must not be null.
  * @param [in] left
  * 		Whether to perform an In-Order (left-side, true) or Reverse In-Order (right-side, false) traversal.
+ * @param [in] visitor
+ * 		Callable taking a node pointer, which returns TRUE to continue the traversal or FALSE to stop it.
+ * @param [in] stack
+ * 		Scratch vector to use as the stack, which is cleared first; reusing one across traversals avoids allocating.
  * @return
- * 		A vector of nonnull pointers in the specified order, as determined from the descendants of node @c what.
+ * 		Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
  ********/
-template<typename NodeData> std::vector<c_BinaryNode<NodeData>*> devTraverseOrd(c_BinaryNode<NodeData>* what, bool left) {
-	std::vector<c_BinaryNode<NodeData>*> out={};
-	if (left && (what->child_L != nullptr)) {
-		out = devTraverseOrd(what->child_L, true);
-	} else if (!left && (what->child_R != nullptr)) {
-		out = devTraverseOrd(what->child_R, false);
+template<typename NodeData, typename Visitor> bool devVisitOrd(c_BinaryNode<NodeData>* what, bool left, Visitor& visitor, std::vector<c_BinaryNode<NodeData>*>& stack) {
+	stack.clear();
+	c_BinaryNode<NodeData>* node = what;
+	while ((node != nullptr) || !stack.empty()) {
+		while (node != nullptr) {
+			stack.push_back(node);
+			node = left ? node->child_L : node->child_R;
+		}
+		node = stack.back();
+		stack.pop_back();
+		if (!visitor(node)) {
+			return false;
+		}
+		node = left ? node->child_R : node->child_L;
 	}
-	out.push_back(what);
-	if (left && (what->child_R != nullptr)) {
-		auto out2 = devTraverseOrd(what->child_R, true);
-		for (c_BinaryNode<NodeData>* i : out2) {
-			out.push_back(i);
+	return true;
+}
+//! Performs an Iterative Ordered Traversal from the specified Binary Node with a temporary stack. See the overload above.
+template<typename NodeData, typename Visitor> bool devVisitOrd(c_BinaryNode<NodeData>* what, bool left, Visitor& visitor) {
+	std::vector<c_BinaryNode<NodeData>*> stack;
+	return devVisitOrd(what, left, visitor, stack);
+}
+
+/********!
+ * @brief
+ *  	Performs an Iterative Special Traversal from the specified Binary Node, handing each node to a visitor as it is reached
+ *  	instead of collecting them. Can operate in Preorder or in Postorder. The nodes still to be visited are held on an
+ *  	explicit stack, so the depth of the tree is not limited by the call stack.
+ * @param [in] what
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] pre
+ * 		Whether to perform a Preorder (true) or Postorder (false) traversal.
+ * @param [in] visitor
+ * 		Callable taking a node pointer, which returns TRUE to continue the traversal or FALSE to stop it.
+ * @param [in] stack
+ * 		Scratch vector to use as the stack, which is cleared first; reusing one across traversals avoids allocating.
+ * @return
+ * 		Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
+ ********/
+template<typename NodeData, typename Visitor> bool devVisitSpc(c_BinaryNode<NodeData>* what, bool pre, Visitor& visitor, std::vector<c_BinaryNode<NodeData>*>& stack) {
+	stack.clear();
+	if (pre) {
+		stack.push_back(what);
+		while (!stack.empty()) {
+			c_BinaryNode<NodeData>* node = stack.back();
+			stack.pop_back();
+			if (!visitor(node)) {
+				return false;
+			}
+			if (node->child_R != nullptr) stack.push_back(node->child_R);
+			if (node->child_L != nullptr) stack.push_back(node->child_L);
 		}
-	} else if (!left && (what->child_L != nullptr)) {
-		auto out2 = devTraverseOrd(what->child_L, false);
-		for (c_BinaryNode<NodeData>* i : out2) {
-			out.push_back(i);
+		return true;
+	}
+	// Postorder: a node on top of the stack is visited once its right subtree is done, which is known by the last visit.
+	c_BinaryNode<NodeData>* node = what, *visited = nullptr;
+	while ((node != nullptr) || !stack.empty()) {
+		if (node != nullptr) {
+			stack.push_back(node);
+			node = node->child_L;
+			continue;
+		}
+		c_BinaryNode<NodeData>* top = stack.back();
+		if ((top->child_R != nullptr) && (top->child_R != visited)) {
+			node = top->child_R;
+		} else {
+			if (!visitor(top)) {
+				return false;
+			}
+			visited = top;
+			stack.pop_back();
 		}
 	}
+	return true;
+}
+//! Performs an Iterative Special Traversal from the specified Binary Node with a temporary stack. See the overload above.
+template<typename NodeData, typename Visitor> bool devVisitSpc(c_BinaryNode<NodeData>* what, bool pre, Visitor& visitor) {
+	std::vector<c_BinaryNode<NodeData>*> stack;
+	return devVisitSpc(what, pre, visitor, stack);
+}
+
+/********!
+ * @brief
+ *  	Performs a Morris (threaded) Ordered Traversal from the specified Binary Node, which needs no stack at all: before
+ *  	descending into a node's first subtree, the last node of that subtree is temporarily linked back to it, and the
+ *  	link is removed again on the way back up. Can operate in In-Order or in Reverse In-Order.
+ * @param [in] what
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] left
+ * 		Whether to perform an In-Order (left-side, true) or Reverse In-Order (right-side, false) traversal.
+ * @param [in] visitor
+ * 		Callable taking a node pointer, which returns TRUE to continue the traversal or FALSE to stop it. While it runs, the
+ * 		tree is temporarily modified, so it must not read the children of other nodes or change the tree.
+ * @return
+ * 		Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
+ * @note
+ * 		Stopping the traversal early still walks the rest of the tree (without visiting it), to remove the links.
+ ********/
+template<typename NodeData, typename Visitor> bool devVisitMorris(c_BinaryNode<NodeData>* what, bool left, Visitor& visitor) {
+	bool running = true;
+	c_BinaryNode<NodeData>* node = what;
+	while (node != nullptr) {
+		c_BinaryNode<NodeData>* first = left ? node->child_L : node->child_R;
+		if (first == nullptr) {
+			if (running && !visitor(node)) running = false;
+			node = left ? node->child_R : node->child_L;
+			continue;
+		}
+		// Find the node visited just before this one, the last node of its first subtree (or the link to this one).
+		c_BinaryNode<NodeData>* before = first;
+		while (true) {
+			c_BinaryNode<NodeData>* next = left ? before->child_R : before->child_L;
+			if ((next == nullptr) || (next == node)) break;
+			before = next;
+		}
+		c_BinaryNode<NodeData>*& link = left ? before->child_R : before->child_L;
+		if (link == nullptr) {
+			link = node;
+			node = first;
+		} else {
+			link = nullptr;
+			if (running && !visitor(node)) running = false;
+			node = left ? node->child_R : node->child_L;
+		}
+	}
+	return running;
+}
+
+//! Visitor that appends every node it is shown to a vector, which lets the vector traversals share the visitor ones.
+template<typename NodeData> struct c_AppendNodes {
+	std::vector<c_BinaryNode<NodeData>*>& output;
+	bool operator()(c_BinaryNode<NodeData>* node) {
+		this->output.push_back(node);
+		return true;
+	}
+};
+
+/********!
+ * @brief
+ *  	Performs an Iterative Ordered Traversal from the specified Binary Node. Can operate in In-Order or in Reverse In-Order.
+ * @param [in] what
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] left
+ * 		Whether to perform an In-Order (left-side, true) or Reverse In-Order (right-side, false) traversal.
+ * @return
+ * 		A vector of nonnull pointers in the specified order, as determined from the descendants of node @c what.
+ ********/
+template<typename NodeData> std::vector<c_BinaryNode<NodeData>*> devTraverseOrd(c_BinaryNode<NodeData>* what, bool left) {
+	std::vector<c_BinaryNode<NodeData>*> out={};
+	c_AppendNodes<NodeData> append = {out};
+	devVisitOrd(what, left, append);
 	return out;
 }
 
 /********!
  * @brief
- *  	Performs a Recursive Special Traversal from the specified Binary Node. Can operate in Preorder or in Postorder.
+ *  	Performs an Iterative Special Traversal from the specified Binary Node. Can operate in Preorder or in Postorder.
  * @param [in] what
  *  	Node to begin the traversal from. Must not be null.
  * @param [in] left
@@ -133,46 +327,315 @@ template<typename NodeData> std::vector<c_BinaryNode<NodeData>*> devTraverseOrd(
  ********/
 template<typename NodeData> std::vector<c_BinaryNode<NodeData>*> devTraverseSpc(c_BinaryNode<NodeData>* what, bool pre) {
 	std::vector<c_BinaryNode<NodeData>*> out={};
-	if (pre) {
-		out.push_back(what);
+	c_AppendNodes<NodeData> append = {out};
+	devVisitSpc(what, pre, append);
+	return out;
+}
+
+/********!
+ * @brief
+ *  	Deletes the specified Binary Node and every node below it, assuming that each was created by the @c new operator. The
+ *  	nodes are torn down by rotating each left child up until the current node has none, then deleting it and moving on to
+ *  	its right child, which takes O(n) time with no extra memory, whatever the shape of the tree.
+ * @param [in] what
+ *  	Node to delete the descendants of, along with itself. May be null.
+ ********/
+template<typename NodeData> void devDeleteTree(c_BinaryNode<NodeData>* what) noexcept {
+	c_BinaryNode<NodeData>* node = what;
+	while (node != nullptr) {
+		if (node->child_L != nullptr) {
+			c_BinaryNode<NodeData>* rotated = node->child_L;
+			node->child_L = rotated->child_R;
+			rotated->child_R = node;
+			node = rotated;
+		} else {
+			c_BinaryNode<NodeData>* next = node->child_R;
+			delete node;
+			node = next;
+		}
 	}
-	if (what->child_L != nullptr) {
-		auto out1 = devTraverseSpc(what->child_L, pre);
-		for (c_BinaryNode<NodeData>* i : out1) {
-			out.push_back(i);
+}
+
+#ifdef ERC_BINTREE_PARALLEL
+// The thread helpers are shared with Graph.hpp (see ParallelThreads.hpp).
+using ParallelThreads::devParallelThreads;
+using ParallelThreads::devRunThreads;
+
+//! Order of a parallel traversal of a c_BinaryTree.
+enum class e_TreeOrder : uint8_t {
+	InOrder,
+	RevOrder,
+	PreOrder,
+	PostOrder
+};
+
+//! One step of the plan of a parallel traversal: either a single node, or the root of a subtree to traverse as a whole.
+template<typename NodeData> struct c_SubtreeTask {
+	c_BinaryNode<NodeData>* node;
+	bool whole;
+};
+
+/********!
+ * @brief
+ *  	Splits the tree below the specified node into a sequence of single nodes and whole subtrees which, when each is
+ *  	traversed in turn, gives the traversal of the entire tree in the specified order. The subtrees are split further, one
+ *  	level at a time, until there are enough of them to share between threads.
+ * @param [in] what
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] order
+ *  	Order of the traversal that the plan is for.
+ * @param [in] wanted
+ *  	Number of whole subtrees to aim for.
+ * @param [out] plan
+ *  	Overwritten with the steps of the traversal, in order.
+ ********/
+template<typename NodeData> void devPlanSubtrees(c_BinaryNode<NodeData>* what, e_TreeOrder order, uint32_t wanted, std::vector<c_SubtreeTask<NodeData>>& plan) {
+	plan.assign(1, c_SubtreeTask<NodeData>{what, true});
+	std::vector<c_SubtreeTask<NodeData>> next;
+	// A chain-like tree only gains one subtree per level, so the splitting gives up after a bounded number of levels.
+	for (uint32_t level=0; level < 32; level++) {
+		uint32_t subtrees = 0;
+		for (const c_SubtreeTask<NodeData>& i : plan) subtrees += i.whole;
+		if (subtrees >= wanted) break;
+		
+		bool split = false;
+		next.clear();
+		for (const c_SubtreeTask<NodeData>& i : plan) {
+			if (!i.whole || ((i.node->child_L == nullptr) && (i.node->child_R == nullptr))) {
+				next.push_back(i);
+				continue;
+			}
+			split = true;
+			const c_SubtreeTask<NodeData> self = {i.node, false}, left = {i.node->child_L, true}, right = {i.node->child_R, true};
+			if (order == e_TreeOrder::PreOrder) next.push_back(self);
+			if (order == e_TreeOrder::RevOrder) {
+				if (right.node != nullptr) next.push_back(right);
+				next.push_back(self);
+				if (left.node != nullptr) next.push_back(left);
+				continue;
+			}
+			if (left.node != nullptr) next.push_back(left);
+			if (order == e_TreeOrder::InOrder) next.push_back(self);
+			if (right.node != nullptr) next.push_back(right);
+			if (order == e_TreeOrder::PostOrder) next.push_back(self);
 		}
+		plan.swap(next);
+		if (!split) break;
 	}
-	if (what->child_R != nullptr) {
-		auto out2 = devTraverseSpc(what->child_R, pre);
-		for (c_BinaryNode<NodeData>* i : out2) {
-			out.push_back(i);
+}
+#endif
+
+/********!
+ * @class c_IndexMap
+ *
+ * @brief
+ * Hash multimap from a tree index (ID) to the position of its node in a tree's node list, using linear probing at a load
+ * factor of at most one half. An index may be stored more than once, at different positions, since nothing prevents two
+ * nodes from sharing an index; lookups then return the earliest position.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_IndexMap {
+	std::vector<uint32_t> keys, positions;
+	uint32_t entries = 0;
+
+	//! Returns the earliest position stored for the index, or -1 if it is not present.
+	uint32_t find(uint32_t index) const noexcept {
+		uint32_t found = -1;
+		if (this->positions.empty()) {
+			return found;
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		for (uint32_t i = hashOf(index) & mask; this->positions[i] != (uint32_t)(-1); i = (i + 1) & mask) {
+			if ((this->keys[i] == index) && (this->positions[i] < found)) {
+				found = this->positions[i];
+			}
 		}
+		return found;
 	}
-	if (!pre) {
-		out.push_back(what);
+	//! Adds an entry for the index at the specified position.
+	void insert(uint32_t index, uint32_t position) {
+		if (((uint64_t)(this->entries) + 1) * 2 > this->positions.size()) {
+			this->reserve(this->entries + 1);
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		uint32_t i = hashOf(index) & mask;
+		while (this->positions[i] != (uint32_t)(-1)) {
+			i = (i + 1) & mask;
+		}
+		this->keys[i] = index;
+		this->positions[i] = position;
+		this->entries++;
 	}
-	return out;
-}
+	//! Removes the entry for the index at the specified position. Returns TRUE if it was present.
+	bool erase(uint32_t index, uint32_t position) noexcept {
+		if (this->positions.empty()) {
+			return false;
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		uint32_t i = hashOf(index) & mask;
+		while ((this->positions[i] != (uint32_t)(-1)) && ((this->keys[i] != index) || (this->positions[i] != position))) {
+			i = (i + 1) & mask;
+		}
+		if (this->positions[i] == (uint32_t)(-1)) {
+			return false;
+		}
+		// Backward-shift deletion: pull each later entry of the cluster into the hole if that keeps it reachable.
+		for (uint32_t j = (i + 1) & mask; this->positions[j] != (uint32_t)(-1); j = (j + 1) & mask) {
+			const uint32_t home = hashOf(this->keys[j]) & mask;
+			if (((j - home) & mask) >= ((j - i) & mask)) {
+				this->keys[i] = this->keys[j];
+				this->positions[i] = this->positions[j];
+				i = j;
+			}
+		}
+		this->positions[i] = -1;
+		this->entries--;
+		return true;
+	}
+	//! Grows the table to hold at least the specified number of entries without rehashing.
+	void reserve(uint32_t needed) {
+		uint64_t capacity = 16;
+		while (capacity < (uint64_t)(needed) * 2) capacity <<= 1;
+		if (capacity <= this->positions.size()) {
+			return;
+		}
+		std::vector<uint32_t> oldKeys, oldPositions;
+		oldKeys.swap(this->keys);
+		oldPositions.swap(this->positions);
+		this->keys.assign(capacity, 0);
+		this->positions.assign(capacity, -1);
+		this->entries = 0;
+		for (uint32_t i=0; i < oldPositions.size(); i++) {
+			if (oldPositions[i] != (uint32_t)(-1)) {
+				this->insert(oldKeys[i], oldPositions[i]);
+			}
+		}
+	}
+	//! Removes every entry.
+	void clear() noexcept {
+		this->keys.clear();
+		this->positions.clear();
+		this->entries = 0;
+	}
+	//! Returns the number of entries stored.
+	uint32_t size() const noexcept {
+		return this->entries;
+	}
+private:
+	static uint32_t hashOf(uint32_t index) noexcept {
+		return (uint32_t)(((uint64_t)(index) * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+};
 
 //! Combined implementation of a Binary Tree, using a set of Binary Nodes and additional data controls.
 template<typename NodeData> struct c_BinaryTree {
-	uint8_t treeHeight;
-	std::vector<c_BinaryNode<NodeData>*> rawData;
-	c_BinaryNode<NodeData>* head;
+	uint8_t treeHeight = 0;
+	std::vector<c_BinaryNode<NodeData>*> rawData; // Every node in level order: the children of position p are at 2p + 1 and 2p + 2.
+	c_BinaryNode<NodeData>* head = nullptr;
+	c_IndexMap indexMap; // Maps each node index (ID) to its position in rawData, for the lookups by index.
+	bool statsCached = false; // Whether every node's subtreeSize and subtreeHeight are kept up to date (see setStatCaching).
+	
+	//! Returns the position within @c rawData of the (first) node with the specified index, or -1 if it is not present.
+	uint32_t findPosition(uint32_t index) const noexcept {
+		return this->indexMap.find(index);
+	}
+	//! Returns the (first) node with the specified index, or nullptr if it is not present.
+	c_BinaryNode<NodeData>* findNode(uint32_t index) const noexcept {
+		const uint32_t position = this->indexMap.find(index);
+		return (position != (uint32_t)(-1)) ? this->rawData[position] : nullptr;
+	}
+	//! Rebuilds the index lookups from @c rawData, which is needed after changing the indexes of nodes (or the contents of
+	//! @c rawData) directly rather than through the tree's methods.
+	void rebuildIndex() {
+		this->indexMap.clear();
+		this->indexMap.reserve(this->rawData.size());
+		for (uint32_t i=0; i < this->rawData.size(); i++) {
+			this->indexMap.insert(this->rawData[i]->index, i);
+		}
+	}
 	
-	//! Calculates the height of the tree (sets @c treeHeight), and returns the total number of nodes.
+	//! Calculates the height of the tree (sets @c treeHeight, capped at 255), and returns the total number of nodes. Runs in
+	//! O(1) time when stat caching is enabled, and as a single iterative pass over the tree otherwise.
 	uint32_t calcStats() {
-		this->treeHeight = this->head->determineDepth();
-		return this->head->determineDescendants();
+		if (this->head == nullptr) {
+			this->treeHeight = 0;
+			return 0;
+		}
+		uint32_t depth, descendants;
+		if (this->statsCached) {
+			depth = this->head->subtreeHeight;
+			descendants = this->head->subtreeSize;
+		} else {
+			this->head->determineStats(depth, descendants);
+		}
+		this->treeHeight = (depth < 255) ? depth : 255;
+		return descendants;
+	}
+	/********!
+	 * @brief
+	 *  	Enables or disables keeping the subtree size and height of every node cached. While enabled, the caches are updated
+	 *  	along the path to the root by each insertion and deletion, in O(log n) time, which makes calcStats O(1) and lets
+	 *  	findInOrder descend straight to its node.
+	 * @param [in] enabled
+	 *  	Whether to keep the caches. Enabling them calculates every node's values in one pass.
+	 * @note
+	 *  	Changing the structure of the tree directly, rather than through its methods, requires calling this again to
+	 *  	recalculate the caches.
+	 ********/
+	void setStatCaching(bool enabled) {
+		this->statsCached = enabled;
+		if (enabled && (this->head != nullptr)) {
+			this->head->cacheSubtreeStats();
+		}
+	}
+	/********!
+	 * @brief
+	 *  	Finds the node at the specified position of the In-Order traversal (the k-th smallest, in a search tree). With stat
+	 *  	caching enabled, this descends from the head using the cached subtree sizes, in O(height) time, which is O(log n)
+	 *  	for the complete trees built by generateFull and insertNode; otherwise it runs the In-Order traversal up to it.
+	 * @param [in] position
+	 *  	Zero-based position within the In-Order traversal.
+	 * @return
+	 *  	The node at that position, or nullptr if the tree has fewer nodes.
+	 ********/
+	c_BinaryNode<NodeData>* findInOrder(uint32_t position) const {
+		if (!this->statsCached) {
+			c_BinaryNode<NodeData>* found = nullptr;
+			this->visitInOrder([&found, &position](c_BinaryNode<NodeData>* node) {
+				if (position-- != 0) return true;
+				found = node;
+				return false;
+			});
+			return found;
+		}
+		c_BinaryNode<NodeData>* node = this->head;
+		while (node != nullptr) {
+			const uint32_t left = (node->child_L != nullptr) ? node->child_L->subtreeSize : 0;
+			if (position == left) {
+				return node;
+			} else if (position < left) {
+				node = node->child_L;
+			} else {
+				position -= left + 1;
+				node = node->child_R;
+			}
+		}
+		return nullptr;
 	}
 	//! Safely deletes the entire binary tree, assuming that each Binary Node was created by the @c new operator.
 	~c_BinaryTree() {
-		auto deleteOrder = this->traversePostOrder();
-		for (c_BinaryNode<NodeData>* i : deleteOrder) {
-			delete i;
-			i = nullptr;
-		}
-		head = nullptr;
+		this->clear();
+	}
+	//! Deletes every node reachable from the head (see devDeleteTree), assuming that each was created by the @c new operator,
+	//! and empties the tree.
+	void clear() noexcept {
+		devDeleteTree(this->head);
+		this->head = nullptr;
+		this->rawData.clear();
+		this->indexMap.clear();
+		this->treeHeight = 0;
 	}
 	/********!
 	 * @brief
@@ -190,132 +653,381 @@ template<typename NodeData> struct c_BinaryTree {
 	 *  8 9 A B   C D E F
 	 ********/
 	void generateFull(uint8_t height, const NodeData prefill) {
+		this->clear();
 		this->treeHeight = height;
 		
-		const uint32_t maxIndex = (1u << height);
-		uint32_t curID = maxIndex - 1, lastSize = 0;
-		for (uint8_t i = (height - 1); i > 0; i--) {
-			const uint32_t levelSize = (1u << i);
-			
-			if (i == (height - 1)) {
-				for (uint32_t j = 0; j < levelSize; j++) {
-					rawData.push_back(new c_BinaryNode<NodeData>(curID, prefill));
-					curID--;
-				}
-			} else {
-				uint32_t prevIndex = rawData.size()-1;
-				for (uint32_t j = 0; j < levelSize; j++) {
-					const uint32_t tmpi = lastSize - (j << 1);
-					rawData.push_back(new c_BinaryNode<NodeData>(curID, prefill,
-						rawData.at( (prevIndex + 2) - tmpi ), rawData.at( (prevIndex + 1) - tmpi )));
-					curID--;
-				}
-			}
-			lastSize = levelSize;
+		// The nodes are made from the last one back, so that each node's children already exist when it is created.
+		const uint32_t size = (1u << height) - 1;
+		this->rawData.assign(size, nullptr);
+		for (uint32_t i = size; i > 0; i--) {
+			const uint32_t left = (2 * i) - 1;
+			this->rawData[i - 1] = (left < size) ? new c_BinaryNode<NodeData>(i, prefill, this->rawData[left], this->rawData[left + 1])
+				: new c_BinaryNode<NodeData>(i, prefill);
+		}
+		this->head = (size != 0) ? this->rawData.front() : nullptr;
+		this->rebuildIndex();
+		this->setStatCaching(this->statsCached);
+	}
+	
+	/********!
+	 * @brief
+	 *  	Traverses the entire structure in a Level-Order (Breadth-First) fashion, handing each node to the visitor as it is
+	 *  	reached instead of collecting them.
+	 * @param [in] visitor
+	 *  	Callable taking a node pointer, which returns TRUE to continue the traversal or FALSE to stop it.
+	 * @param [in] scratch
+	 *  	If non-null, the vector to hold the queue in, which is cleared first; reusing one across traversals avoids
+	 *  	allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
+	 ********/
+	template<typename Visitor> bool visitBreadth(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		std::vector<c_BinaryNode<NodeData>*> local;
+		std::vector<c_BinaryNode<NodeData>*>& queue = (scratch != nullptr) ? *scratch : local;
+		queue.clear();
+		if (this->head != nullptr) queue.push_back(this->head);
+		for (uint32_t i=0; i < queue.size(); i++) {
+			c_BinaryNode<NodeData>* ptr = queue[i];
+			if (!visitor(ptr)) return false;
+			if (ptr->child_L != nullptr) queue.push_back(ptr->child_L);
+			if (ptr->child_R != nullptr) queue.push_back(ptr->child_R);
 		}
-		rawData.push_back(new c_BinaryNode<NodeData>(1, prefill, rawData.back(), rawData.at(rawData.size() - 2)));
-		head = rawData.back();
+		return true;
+	}
+	//! Traverses the entire structure in an In-Order fashion, handing each node to the visitor (which returns FALSE to stop).
+	template<typename Visitor> bool visitInOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitOrd(this->head, true, visitor, *scratch) : devVisitOrd(this->head, true, visitor);
+	}
+	//! Traverses the entire structure in a Reverse-Order fashion, handing each node to the visitor (which returns FALSE to stop).
+	template<typename Visitor> bool visitRevOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitOrd(this->head, false, visitor, *scratch) : devVisitOrd(this->head, false, visitor);
+	}
+	//! Traverses the entire structure in a Pre-Order fashion, handing each node to the visitor (which returns FALSE to stop).
+	template<typename Visitor> bool visitPreOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitSpc(this->head, true, visitor, *scratch) : devVisitSpc(this->head, true, visitor);
+	}
+	//! Traverses the entire structure in a Post-Order fashion, handing each node to the visitor (which returns FALSE to stop).
+	//! Like visitBreadth, each of these traversals can be given a scratch vector to hold its stack, or else uses its own.
+	template<typename Visitor> bool visitPostOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitSpc(this->head, false, visitor, *scratch) : devVisitSpc(this->head, false, visitor);
+	}
+	//! Traverses the entire structure in an In-Order fashion with no stack, by temporarily threading the tree (see
+	//! devVisitMorris), handing each node to the visitor (which returns FALSE to stop, and must not touch the tree).
+	template<typename Visitor> bool visitInOrderMorris(Visitor visitor) {
+		return (this->head == nullptr) || devVisitMorris(this->head, true, visitor);
+	}
+	//! Traverses the entire structure in a Reverse-Order fashion with no stack, by temporarily threading the tree (see
+	//! devVisitMorris), handing each node to the visitor (which returns FALSE to stop, and must not touch the tree).
+	template<typename Visitor> bool visitRevOrderMorris(Visitor visitor) {
+		return (this->head == nullptr) || devVisitMorris(this->head, false, visitor);
 	}
 	
 	//! Traverses the entire structure in a Level-Order (Breadth-First) fashion and returns the reorganized pointers.
 	std::vector<c_BinaryNode<NodeData>*> traverseBreadth() const noexcept {
-		std::vector<c_BinaryNode<NodeData>*> output = {}, last = {this->head}, childs = {};
-		for (uint8_t i=0; i < this->treeHeight; i++) {
-			for (c_BinaryNode<NodeData>* ptr : last) {
-				if (ptr == nullptr) continue;
-				childs.push_back(ptr->child_L);
-				childs.push_back(ptr->child_R);
-				output.push_back(ptr);
-			}
-			if (childs.empty()) break;
-			else {
-				last = childs;
-				childs.clear();
-			}
-		}
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->rawData.size());
+		this->visitBreadth(c_AppendNodes<NodeData>{output});
 		return output;
 	}
 	
 	//! Traverses the entire structure in an In-Order fashion and returns the reorganized pointers.
 	std::vector<c_BinaryNode<NodeData>*> traverseInOrder() const noexcept {
-		std::vector<c_BinaryNode<NodeData>*> output = devTraverseOrd(this->head, true);
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->rawData.size());
+		this->visitInOrder(c_AppendNodes<NodeData>{output});
 		return output;
 	}
 	
 	//! Traverses the entire structure in a Reverse-Order fashion and returns the reorganized pointers.
 	std::vector<c_BinaryNode<NodeData>*> traverseRevOrder() const noexcept {
-		std::vector<c_BinaryNode<NodeData>*> output = devTraverseOrd(this->head, false);
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->rawData.size());
+		this->visitRevOrder(c_AppendNodes<NodeData>{output});
 		return output;
 	}
 	
 	//! Traverses the entire structure in a Pre-Order fashion and returns the reorganized pointers.
 	std::vector<c_BinaryNode<NodeData>*> traversePreOrder() const noexcept {
-		std::vector<c_BinaryNode<NodeData>*> output = devTraverseSpc(this->head, true);
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->rawData.size());
+		this->visitPreOrder(c_AppendNodes<NodeData>{output});
 		return output;
 	}
 	
 	//! Traverses the entire structure in a Post-Order fashion and returns the reorganized pointers.
 	std::vector<c_BinaryNode<NodeData>*> traversePostOrder() const noexcept {
-		std::vector<c_BinaryNode<NodeData>*> output = devTraverseSpc(this->head, false);
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->rawData.size());
+		this->visitPostOrder(c_AppendNodes<NodeData>{output});
 		return output;
 	}
+
+#ifdef ERC_BINTREE_PARALLEL
+	/********!
+	 * @brief
+	 *  	Overwrites the entire object with a freshly-constructed, balanced binary tree, like generateFull, but with the
+	 *  	nodes of every level created and linked by several threads at once. The subtree sizes and heights are known from
+	 *  	the shape of the tree, so they are filled in as the nodes are linked rather than in a separate pass.
+	 * @param [in] height
+	 *  	Height of the binary tree to generate.
+	 * @param [in] prefill
+	 *  	The default value to set all nodes to.
+	 * @param [in] threads
+	 *  	Number of threads to use, or 0 for one per hardware thread.
+	 * @note
+	 *  	The index lookups are still rebuilt by the calling thread alone.
+	 ********/
+	void generateFullParallel(uint8_t height, const NodeData prefill, uint32_t threads = 0) {
+		this->clear();
+		this->treeHeight = height;
+		threads = devParallelThreads(threads);
+		
+		// Each thread owns a contiguous range of positions, which holds whole runs of nodes from one or two levels.
+		const uint32_t size = (1u << height) - 1;
+		this->rawData.assign(size, nullptr);
+		std::vector<c_BinaryNode<NodeData>*>& nodes = this->rawData;
+		auto create = [&](uint32_t t) {
+			const uint32_t first = (uint32_t)(((uint64_t)(size) * t) / threads), last = (uint32_t)(((uint64_t)(size) * (t + 1)) / threads);
+			for (uint32_t i=first; i < last; i++) {
+				nodes[i] = new c_BinaryNode<NodeData>(i + 1, prefill);
+			}
+		};
+		devRunThreads(threads, create);
+		auto link = [&](uint32_t t) {
+			const uint32_t first = (uint32_t)(((uint64_t)(size) * t) / threads), last = (uint32_t)(((uint64_t)(size) * (t + 1)) / threads);
+			for (uint32_t i=first; i < last; i++) {
+				c_BinaryNode<NodeData>* node = nodes[i];
+				uint32_t depth = 0;
+				for (uint32_t index = i + 1; index != 0; index >>= 1) depth++;
+				if ((2 * i) + 1 < size) {
+					node->child_L = nodes[(2 * i) + 1];
+					node->child_R = nodes[(2 * i) + 2];
+				}
+				node->subtreeHeight = height + 1 - depth;
+				node->subtreeSize = (1u << node->subtreeHeight) - 1;
+			}
+		};
+		devRunThreads(threads, link);
+		this->head = (size != 0) ? this->rawData.front() : nullptr;
+		this->rebuildIndex();
+	}
 	
 	/********!
 	 * @brief
-	 *  	Inserts a new node with a specified value into the tree at the first possible open position.
-	 * @param [in] value
-	 *  	The new value to insert into the Binary Tree.
+	 *  	Traverses the entire structure in the specified order on several threads, and returns the reorganized pointers. The
+	 *  	tree is split into subtrees (see devPlanSubtrees), which the threads claim one at a time and traverse into their
+	 *  	own segments; the segments are then copied into place at offsets found from their sizes, also in parallel.
+	 * @param [in] order
+	 *  	Order of the traversal.
+	 * @param [in] threads
+	 *  	Number of threads to use, or 0 for one per hardware thread.
 	 * @return
-	 *  	The tree index (ID) of the new node.
+	 *  	The same vector as the matching sequential traversal (such as traverseInOrder) would return.
 	 ********/
-	uint32_t insertNode(const NodeData value) {
-		c_BinaryNode<NodeData>* newroot = nullptr;
-		bool goLeft = true;
-		std::vector<c_BinaryNode<NodeData>*> last = {this->head}, childs = {};
-		while (newroot == nullptr) {
-			for (auto ptr : last) {
-				if (ptr->child_L == nullptr) {
-					newroot = ptr;
-				} else if (ptr->child_R == nullptr) {
-					goLeft = false;
-					newroot = ptr;
+	std::vector<c_BinaryNode<NodeData>*> traverseParallel(e_TreeOrder order, uint32_t threads = 0) const {
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		if (this->head == nullptr) {
+			return output;
+		}
+		threads = devParallelThreads(threads);
+		std::vector<c_SubtreeTask<NodeData>> plan;
+		devPlanSubtrees(this->head, order, threads * 8, plan);
+		const uint32_t steps = plan.size();
+		
+		std::vector<std::vector<c_BinaryNode<NodeData>*>> segments(steps);
+		std::atomic<uint32_t> next_step(0);
+		auto traverse = [&](uint32_t) {
+			std::vector<c_BinaryNode<NodeData>*> stack;
+			for (uint32_t i; (i = next_step.fetch_add(1, std::memory_order_relaxed)) < steps;) {
+				if (!plan[i].whole) continue;
+				c_AppendNodes<NodeData> append = {segments[i]};
+				if ((order == e_TreeOrder::InOrder) || (order == e_TreeOrder::RevOrder)) {
+					devVisitOrd(plan[i].node, order == e_TreeOrder::InOrder, append, stack);
 				} else {
-					childs.push_back(ptr);
+					devVisitSpc(plan[i].node, order == e_TreeOrder::PreOrder, append, stack);
 				}
 			}
-			last = childs; childs.clear();
+		};
+		devRunThreads(threads, traverse);
+		
+		// Stitching: every segment has a fixed place in the output, so the copies do not need to coordinate.
+		std::vector<uint32_t> offsets(steps + 1, 0);
+		for (uint32_t i=0; i < steps; i++) {
+			offsets[i + 1] = offsets[i] + (plan[i].whole ? (uint32_t)(segments[i].size()) : 1);
 		}
-		uint32_t nindex = this->rawData.front()->index + 1;
-		this->rawData.insert(this->rawData.begin(), new c_BinaryNode<NodeData>(nindex, value));
-		if (goLeft) {newroot.child_L = this->rawData.front();} else {newroot.child_R = this->rawData.front();}
+		output.resize(offsets[steps]);
+		next_step.store(0, std::memory_order_relaxed);
+		auto stitch = [&](uint32_t) {
+			for (uint32_t i; (i = next_step.fetch_add(1, std::memory_order_relaxed)) < steps;) {
+				if (!plan[i].whole) {
+					output[offsets[i]] = plan[i].node;
+					continue;
+				}
+				for (uint32_t j=0; j < segments[i].size(); j++) {
+					output[offsets[i] + j] = segments[i][j];
+				}
+			}
+		};
+		devRunThreads(threads, stitch);
+		return output;
+	}
+	
+	/********!
+	 * @brief
+	 *  	Reduces every node of the tree to one value on several threads. Each thread claims subtrees (see devPlanSubtrees)
+	 *  	and folds them on its own, and the partial results are then combined in Pre-Order, so the result is the same as a
+	 *  	sequential Pre-Order fold whenever @c combine is associative.
+	 * @param [in] identity
+	 *  	Starting value of every fold, which @c combine must leave the other operand unchanged with.
+	 * @param [in] map
+	 *  	Callable taking a node pointer and returning its value. Called from several threads at once.
+	 * @param [in] combine
+	 *  	Callable taking two values and returning their combination. Called from several threads at once.
+	 * @param [in] threads
+	 *  	Number of threads to use, or 0 for one per hardware thread.
+	 * @return
+	 *  	The combination of the values of every node, or @c identity for an empty tree.
+	 ********/
+	template<typename T, typename Map, typename Combine> T reduceParallel(const T& identity, Map map, Combine combine, uint32_t threads = 0) const {
+		if (this->head == nullptr) {
+			return identity;
+		}
+		threads = devParallelThreads(threads);
+		std::vector<c_SubtreeTask<NodeData>> plan;
+		devPlanSubtrees(this->head, e_TreeOrder::PreOrder, threads * 8, plan);
+		const uint32_t steps = plan.size();
+		
+		// The partial results are wrapped so that a T of bool does not end up in a packed (and shared) std::vector<bool>.
+		struct c_Partial { T value; };
+		std::vector<c_Partial> partials(steps, c_Partial{identity});
+		std::atomic<uint32_t> next_step(0);
+		auto reduce = [&](uint32_t) {
+			std::vector<c_BinaryNode<NodeData>*> stack;
+			for (uint32_t i; (i = next_step.fetch_add(1, std::memory_order_relaxed)) < steps;) {
+				if (!plan[i].whole) {
+					partials[i].value = map(plan[i].node);
+					continue;
+				}
+				T& value = partials[i].value;
+				auto fold = [&](c_BinaryNode<NodeData>* node) {
+					value = combine(value, map(node));
+					return true;
+				};
+				devVisitSpc(plan[i].node, true, fold, stack);
+			}
+		};
+		devRunThreads(threads, reduce);
+		
+		T result = identity;
+		for (const c_Partial& i : partials) {
+			result = combine(result, i.value);
+		}
+		return result;
+	}
+#endif
+	
+	// Places a new node at the next position in level order, linking it to its parent (at (p - 1) / 2) or making it the
+	// head, and updates the height if it starts a new level.
+	void appendNode(uint32_t index, const NodeData& value) {
+		const uint32_t position = this->rawData.size();
+		c_BinaryNode<NodeData>* node = new c_BinaryNode<NodeData>(index, value);
+		this->rawData.push_back(node);
+		this->indexMap.insert(index, position);
+		if (position == 0) {
+			this->head = node;
+		} else if (position & 1) {
+			this->rawData[(position - 1) / 2]->child_L = node;
+		} else {
+			this->rawData[(position - 1) / 2]->child_R = node;
+		}
+		uint32_t depth = 0;
+		for (uint32_t i = position + 1; i != 0; i >>= 1) depth++;
+		if ((depth > this->treeHeight) && (depth < 256)) {
+			this->treeHeight = depth;
+		}
+		if (this->statsCached) {
+			this->refreshAncestors(position);
+		}
+	}
+	// Recalculates the cached stats of every ancestor of the specified position, from its parent up to the head.
+	void refreshAncestors(uint32_t position) noexcept {
+		while (position != 0) {
+			position = (position - 1) / 2;
+			this->rawData[position]->refreshSubtreeStats();
+		}
+	}
+	/********!
+	 * @brief
+	 *  	Inserts a new node with a specified value into the tree at the first possible open position, which is the next
+	 *  	position in level order, in O(1) amortized time.
+	 * @param [in] value
+	 *  	The new value to insert into the Binary Tree.
+	 * @return
+	 *  	The tree index (ID) of the new node, which is one more than that of the last node (or 1 for an empty tree).
+	 ********/
+	uint32_t insertNode(const NodeData value) {
+		const uint32_t nindex = this->rawData.empty() ? 1 : (this->rawData.back()->index + 1);
+		this->appendNode(nindex, value);
 		return nindex;
 	}
+	/********!
+	 * @brief
+	 *  	Inserts a batch of new nodes, in order, at the next open positions of the tree, filling out the remaining levels
+	 *  	in one pass. The result is the same as calling insertNode for each value, but for forward (or better) iterators
+	 *  	the storage is only grown once. Input iterators are read a single time, as they go.
+	 * @param [in] first
+	 *  	Iterator to the first value to insert.
+	 * @param [in] last
+	 *  	Iterator past the last value to insert.
+	 * @return
+	 *  	The number of nodes inserted.
+	 ********/
+	template<typename Iter> uint32_t insertNodes(Iter first, Iter last) {
+		if constexpr (std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<Iter>::iterator_category>::value) {
+			const uint32_t incoming = std::distance(first, last);
+			this->rawData.reserve(this->rawData.size() + incoming);
+			this->indexMap.reserve(this->indexMap.size() + incoming);
+		}
+		uint32_t added = 0;
+		uint32_t nindex = this->rawData.empty() ? 1 : (this->rawData.back()->index + 1);
+		for (; first != last; ++first) {
+			this->appendNode(nindex++, *first);
+			added++;
+		}
+		return added;
+	}
+	//! Inserts a batch of new nodes from any range of values (such as a vector). See the iterator overload for details.
+	template<typename Range> uint32_t insertNodes(const Range& values) {
+		return this->insertNodes(values.begin(), values.end());
+	}
+	//! Inserts a batch of new nodes from a list of values. See the iterator overload for details.
+	uint32_t insertNodes(std::initializer_list<NodeData> values) {
+		return this->insertNodes(values.begin(), values.end());
+	}
 	
 	/********!
 	 * @brief
-	 *  	Replaces the value stored in the node with the specified index without disrupting its connections.
+	 *  	Replaces the value stored in the node with the specified index without disrupting its connections. Finds the node
+	 *  	in O(1) expected time.
 	 * @param [in] indexFind
 	 *  	The tree index (ID) of the node to update.
 	 * @param [in] newVal
 	 *  	The new value to set.
 	 ********/
 	void replaceNodeData(uint32_t indexFind, const NodeData newVal) {
-		c_BinaryNode<NodeData>* target = nullptr;
-		std::vector<c_BinaryNode<NodeData>*> last = {this->head}, childs = {};
-		while (target == nullptr) {
-			for (auto ptr : last) {
-				if (ptr == nullptr) continue;
-				if (ptr->index == indexFind) target = ptr;
-			}
-			last = childs; 	childs.clear();
-			if (last.empty()) return; // Cannot complete if index doesn't exist.
-		}
-		target.nodeData = newVal;
+		c_BinaryNode<NodeData>* target = this->findNode(indexFind);
+		if (target == nullptr) return; // Cannot complete if index doesn't exist.
+		target->nodeData = newVal;
 	}
 	
 	/********!
 	 * @brief
-	 *  	Replaces the node at the specified index, resetting its index but retaining its connections.
+	 *  	Replaces the node at the specified index, resetting its index but retaining its connections. Finds the node in O(1)
+	 *  	expected time.
 	 * @param [in] indexFind
 	 *  	The tree index (ID) of the node to update.
 	 * @param [in] newVal
@@ -324,24 +1036,19 @@ template<typename NodeData> struct c_BinaryTree {
 	 *  	The new tree index (ID) to assign to the node.
 	 ********/
 	void replaceNodeFull(uint32_t indexFind, const NodeData newVal, const uint32_t newIndex) {
-		c_BinaryNode<NodeData>* target = nullptr;
-		std::vector<c_BinaryNode<NodeData>*> last = {this->head}, childs = {};
-		while (target == nullptr) {
-			for (auto ptr : last) {
-				if (ptr == nullptr) continue;
-				if (ptr->index == indexFind) target = ptr;
-			}
-			last = childs; childs.clear();
-			if (last.empty()) return; // Cannot complete if index doesn't exist.
-		}
-		target.nodeData = newVal;
-		target.index = newIndex;
+		const uint32_t position = this->findPosition(indexFind);
+		if (position == (uint32_t)(-1)) return; // Cannot complete if index doesn't exist.
+		c_BinaryNode<NodeData>* target = this->rawData[position];
+		this->indexMap.erase(indexFind, position);
+		this->indexMap.insert(newIndex, position);
+		target->nodeData = newVal;
+		target->index = newIndex;
 	}
 	
 	/********!
 	 * @brief
 	 *  	Finds and deletes the (first) node it encounters with the specified index, updating the internal structure of
-	 *  	the binary tree accordingly.
+	 *  	the binary tree accordingly: the last node of the tree is moved into its place. Runs in O(1) expected time.
 	 * @param [in] index
 	 *  	The tree index (ID) of the node to remove.
 	 * @return
@@ -349,34 +1056,664 @@ template<typename NodeData> struct c_BinaryTree {
 	 *  	0 if the node could not be found or if the node was the last node within the binary tree.
 	 ********/
 	uint32_t deleteNode(uint32_t index) {
-		c_BinaryNode<NodeData>* replacement = this->rawData.front(), *target = nullptr, *repParent = nullptr;
-		bool parentLeft = true;
-		for (uint32_t i=0; i < this->rawData.size(); i++) {
-			if (this->rawData.at(i)->index == index) {
-				target = this->rawData.at(i);
-			} else if (this->rawData.at(i)->child_L == replacement) {
-				repParent = this->rawData.at(i);
-			} else if (this->rawData.at(i)->child_R == replacement) {
-				repParent = this->rawData.at(i); parentLeft = false;
-			}
+		const uint32_t position = this->findPosition(index);
+		if (position == (uint32_t)(-1)) return 0;
+		const uint32_t last = this->rawData.size() - 1;
+		c_BinaryNode<NodeData>* target = this->rawData[position], *replacement = this->rawData[last];
+		this->indexMap.erase(index, position);
+		// Detach the last node from its parent, which sits at (last - 1) / 2 by the level order.
+		if (last == 0) {
+			this->head = nullptr;
+		} else if (last & 1) {
+			this->rawData[(last - 1) / 2]->child_L = nullptr;
+		} else {
+			this->rawData[(last - 1) / 2]->child_R = nullptr;
+		}
+		this->rawData.pop_back();
+		if (this->statsCached) {
+			this->refreshAncestors(last);
 		}
-		if (target == nullptr) return 0;
-		else if (target == replacement) {
-			this->rawData.erase(this->rawData.begin());
+		if (target == replacement) {
+			delete replacement;
 			return 0;
 		}
+		this->indexMap.erase(replacement->index, last);
+		this->indexMap.insert(replacement->index, position);
 		target->index = replacement->index;
 		target->nodeData = replacement->nodeData;
-		replacement->index = 0;
-		if (parentLeft) {
-			repParent->child_L = nullptr;
-		} else {
-			repParent->child_R = nullptr;
-		}
 		delete replacement;
-		this->rawData.erase(this->rawData.begin());
 		return target->index;
 	} 
 };
+
+//! Default comparator of a c_SearchTree, which orders values by their @c < operator.
+struct c_Less {
+	template<typename T> bool operator()(const T& a, const T& b) const {
+		return a < b;
+	}
+};
+
+/********!
+ * @class c_SearchTree
+ *
+ * @brief
+ * Ordered binary search tree of unique values, kept balanced as an AVL tree, which gives O(log n) lookups, insertions,
+ * deletions and rank queries, and range scans in O(log n + k) time. It is made of the same Binary Nodes as c_BinaryTree,
+ * whose cached subtree heights serve as the balance information and whose cached subtree sizes give the ranks; the
+ * @c index of each node is the order in which it was inserted, from 1.
+ *
+ * @tparam NodeData
+ *  	Type of the values held in the tree.
+ * @tparam Compare
+ *  	Callable taking two values and returning TRUE if the first is ordered before the second. Two values that are not
+ *  	ordered either way are treated as equal.
+ *
+ * @note
+ * The tree is restructured by every insertion and deletion, so (unlike the nodes themselves) positions within it are not
+ * stable, and the nodes must not be restructured or have their values changed directly.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+template<typename NodeData, typename Compare = c_Less> class c_SearchTree {
+	c_BinaryNode<NodeData>* head = nullptr;
+	uint32_t inserted = 0; // Number of insertions so far, which numbers the nodes.
+	Compare compare;
+	std::vector<c_BinaryNode<NodeData>**> linkStack; // Reused by the insertions and deletions, so that they do not allocate.
+	
+	static uint32_t heightOf(const c_BinaryNode<NodeData>* node) noexcept {
+		return (node != nullptr) ? node->subtreeHeight : 0;
+	}
+	static uint32_t sizeOf(const c_BinaryNode<NodeData>* node) noexcept {
+		return (node != nullptr) ? node->subtreeSize : 0;
+	}
+	// Rotates the left child of the node up into its place, and returns it.
+	static c_BinaryNode<NodeData>* rotateRight(c_BinaryNode<NodeData>* node) noexcept {
+		c_BinaryNode<NodeData>* left = node->child_L;
+		node->child_L = left->child_R;
+		left->child_R = node;
+		node->refreshSubtreeStats();
+		left->refreshSubtreeStats();
+		return left;
+	}
+	// Rotates the right child of the node up into its place, and returns it.
+	static c_BinaryNode<NodeData>* rotateLeft(c_BinaryNode<NodeData>* node) noexcept {
+		c_BinaryNode<NodeData>* right = node->child_R;
+		node->child_R = right->child_L;
+		right->child_L = node;
+		node->refreshSubtreeStats();
+		right->refreshSubtreeStats();
+		return right;
+	}
+	// Refreshes the stats of a node whose subtrees are balanced, and rotates it if they differ in height by two, returning
+	// the node that takes its place.
+	static c_BinaryNode<NodeData>* rebalance(c_BinaryNode<NodeData>* node) noexcept {
+		node->refreshSubtreeStats();
+		const uint32_t hL = heightOf(node->child_L), hR = heightOf(node->child_R);
+		if (hL > hR + 1) {
+			if (heightOf(node->child_L->child_L) < heightOf(node->child_L->child_R)) {
+				node->child_L = rotateLeft(node->child_L);
+			}
+			return rotateRight(node);
+		}
+		if (hR > hL + 1) {
+			if (heightOf(node->child_R->child_R) < heightOf(node->child_R->child_L)) {
+				node->child_R = rotateRight(node->child_R);
+			}
+			return rotateLeft(node);
+		}
+		return node;
+	}
+	// Rebalances every node along the recorded path of links, from the deepest up.
+	void rebalancePath() noexcept {
+		for (uint32_t i = this->linkStack.size(); i > 0; i--) {
+			c_BinaryNode<NodeData>** link = this->linkStack[i - 1];
+			*link = rebalance(*link);
+		}
+	}
+	
+public:
+	//! Construct an empty tree, with an optional comparator object.
+	c_SearchTree(Compare comparator = Compare()) : compare(comparator) {}
+	c_SearchTree(const c_SearchTree&) = delete;
+	c_SearchTree& operator=(const c_SearchTree&) = delete;
+	//! Safely deletes the entire tree.
+	~c_SearchTree() {
+		this->clear();
+	}
+	//! Deletes every node (see devDeleteTree), and empties the tree.
+	void clear() noexcept {
+		devDeleteTree(this->head);
+		this->head = nullptr;
+	}
+	
+	//! Returns the root node of the tree, or nullptr if it is empty.
+	c_BinaryNode<NodeData>* root() const noexcept {
+		return this->head;
+	}
+	//! Returns the number of values in the tree.
+	uint32_t size() const noexcept {
+		return sizeOf(this->head);
+	}
+	//! Returns the height of the tree, which is at most about 1.44 log2(n).
+	uint32_t height() const noexcept {
+		return heightOf(this->head);
+	}
+	//! Returns TRUE if the tree holds no values.
+	bool empty() const noexcept {
+		return this->head == nullptr;
+	}
+	
+	//! Returns the node holding a value equal to the specified one, or nullptr if there is none.
+	c_BinaryNode<NodeData>* find(const NodeData& value) const {
+		c_BinaryNode<NodeData>* node = this->head;
+		while (node != nullptr) {
+			if (this->compare(value, node->nodeData)) {
+				node = node->child_L;
+			} else if (this->compare(node->nodeData, value)) {
+				node = node->child_R;
+			} else {
+				return node;
+			}
+		}
+		return nullptr;
+	}
+	//! Returns TRUE if the tree holds a value equal to the specified one.
+	bool contains(const NodeData& value) const {
+		return this->find(value) != nullptr;
+	}
+	//! Returns the node holding the smallest value that is not ordered before the specified one, or nullptr if there is none.
+	c_BinaryNode<NodeData>* lowerBound(const NodeData& value) const {
+		c_BinaryNode<NodeData>* node = this->head, * found = nullptr;
+		while (node != nullptr) {
+			if (this->compare(node->nodeData, value)) {
+				node = node->child_R;
+			} else {
+				found = node;
+				node = node->child_L;
+			}
+		}
+		return found;
+	}
+	//! Returns the node holding the smallest value that is ordered after the specified one, or nullptr if there is none.
+	c_BinaryNode<NodeData>* upperBound(const NodeData& value) const {
+		c_BinaryNode<NodeData>* node = this->head, * found = nullptr;
+		while (node != nullptr) {
+			if (this->compare(value, node->nodeData)) {
+				found = node;
+				node = node->child_L;
+			} else {
+				node = node->child_R;
+			}
+		}
+		return found;
+	}
+	//! Returns the node at the specified zero-based position in order (the k-th smallest value), or nullptr if the tree has
+	//! fewer values.
+	c_BinaryNode<NodeData>* atRank(uint32_t position) const noexcept {
+		c_BinaryNode<NodeData>* node = this->head;
+		while (node != nullptr) {
+			const uint32_t left = sizeOf(node->child_L);
+			if (position == left) break;
+			if (position < left) {
+				node = node->child_L;
+			} else {
+				position -= left + 1;
+				node = node->child_R;
+			}
+		}
+		return node;
+	}
+	//! Returns the number of values in the tree that are ordered before the specified one.
+	uint32_t rank(const NodeData& value) const {
+		uint32_t before = 0;
+		c_BinaryNode<NodeData>* node = this->head;
+		while (node != nullptr) {
+			if (this->compare(node->nodeData, value)) {
+				before += sizeOf(node->child_L) + 1;
+				node = node->child_R;
+			} else {
+				node = node->child_L;
+			}
+		}
+		return before;
+	}
+	
+	/********!
+	 * @brief
+	 *  	Inserts a value into the tree, unless it already holds an equal one, and rebalances the path back to the root.
+	 * @param [in] value
+	 *  	The value to insert.
+	 * @return
+	 *  	Returns TRUE if the value was inserted, or FALSE if an equal value was already present (and left unchanged).
+	 ********/
+	bool insert(const NodeData& value) {
+		std::vector<c_BinaryNode<NodeData>**>& path = this->linkStack;
+		path.clear();
+		c_BinaryNode<NodeData>** link = &this->head;
+		while (*link != nullptr) {
+			path.push_back(link);
+			if (this->compare(value, (*link)->nodeData)) {
+				link = &(*link)->child_L;
+			} else if (this->compare((*link)->nodeData, value)) {
+				link = &(*link)->child_R;
+			} else {
+				return false;
+			}
+		}
+		*link = new c_BinaryNode<NodeData>(++this->inserted, value);
+		this->rebalancePath();
+		return true;
+	}
+	//! Inserts every value of a range (anything with @c begin() and @c end(), such as a vector). Returns the number of them
+	//! that were inserted, skipping those already present.
+	template<typename Range> uint32_t insertAll(const Range& values) {
+		uint32_t added = 0;
+		for (const NodeData& i : values) {
+			added += this->insert(i);
+		}
+		return added;
+	}
+	/********!
+	 * @brief
+	 *  	Removes the value equal to the specified one from the tree, and rebalances the path back to the root. A node with
+	 *  	two children is replaced by the node of its in-order successor, so no other node is moved or copied.
+	 * @param [in] value
+	 *  	The value to remove.
+	 * @return
+	 *  	Returns TRUE if the value was removed, or FALSE if it was not present.
+	 ********/
+	bool erase(const NodeData& value) {
+		std::vector<c_BinaryNode<NodeData>**>& path = this->linkStack;
+		path.clear();
+		c_BinaryNode<NodeData>** link = &this->head;
+		while (*link != nullptr) {
+			if (this->compare(value, (*link)->nodeData)) {
+				path.push_back(link);
+				link = &(*link)->child_L;
+			} else if (this->compare((*link)->nodeData, value)) {
+				path.push_back(link);
+				link = &(*link)->child_R;
+			} else {
+				break;
+			}
+		}
+		c_BinaryNode<NodeData>* target = *link;
+		if (target == nullptr) {
+			return false;
+		}
+		
+		if ((target->child_L == nullptr) || (target->child_R == nullptr)) {
+			*link = (target->child_L != nullptr) ? target->child_L : target->child_R;
+		} else {
+			// Unlink the successor (the leftmost node of the right subtree) and give it the target's place and children.
+			const uint32_t at = path.size();
+			path.push_back(link);
+			c_BinaryNode<NodeData>** successorLink = &target->child_R;
+			while ((*successorLink)->child_L != nullptr) {
+				path.push_back(successorLink);
+				successorLink = &(*successorLink)->child_L;
+			}
+			c_BinaryNode<NodeData>* successor = *successorLink;
+			*successorLink = successor->child_R;
+			successor->child_L = target->child_L;
+			successor->child_R = target->child_R;
+			*link = successor;
+			// The link below the target's place belonged to the target, and now belongs to the successor.
+			if (path.size() > at + 1) path[at + 1] = &successor->child_R;
+		}
+		delete target;
+		this->rebalancePath();
+		return true;
+	}
+	
+	//! Traverses the values in order, handing each node to the visitor (which returns FALSE to stop).
+	template<typename Visitor> bool visitInOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitOrd(this->head, true, visitor, *scratch) : devVisitOrd(this->head, true, visitor);
+	}
+	//! Traverses the values in reverse order, handing each node to the visitor (which returns FALSE to stop). Both can be
+	//! given a scratch vector to hold their stack, as with visitRange, or else use their own.
+	template<typename Visitor> bool visitRevOrder(Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		if (this->head == nullptr) return true;
+		return (scratch != nullptr) ? devVisitOrd(this->head, false, visitor, *scratch) : devVisitOrd(this->head, false, visitor);
+	}
+	/********!
+	 * @brief
+	 *  	Traverses the values from @c low to @c high (both inclusive) in order, handing each node to the visitor. The first
+	 *  	node is found in O(log n) time, and each one after it in O(1) amortized time.
+	 * @param [in] low
+	 *  	The smallest value to visit.
+	 * @param [in] high
+	 *  	The largest value to visit.
+	 * @param [in] visitor
+	 *  	Callable taking a node pointer, which returns TRUE to continue the traversal or FALSE to stop it.
+	 * @param [in] scratch
+	 *  	If non-null, the vector to hold the stack in, which is cleared first; reusing one across traversals avoids
+	 *  	allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
+	 ********/
+	template<typename Visitor> bool visitRange(const NodeData& low, const NodeData& high, Visitor visitor, std::vector<c_BinaryNode<NodeData>*>* scratch = nullptr) const {
+		std::vector<c_BinaryNode<NodeData>*> local;
+		std::vector<c_BinaryNode<NodeData>*>& stack = (scratch != nullptr) ? *scratch : local;
+		stack.clear();
+		// The stack holds the path of nodes not before @c low whose left subtrees have been (or are being) visited.
+		for (c_BinaryNode<NodeData>* node = this->head; node != nullptr;) {
+			if (this->compare(node->nodeData, low)) {
+				node = node->child_R;
+			} else {
+				stack.push_back(node);
+				node = node->child_L;
+			}
+		}
+		while (!stack.empty()) {
+			c_BinaryNode<NodeData>* node = stack.back();
+			stack.pop_back();
+			if (this->compare(high, node->nodeData)) break;
+			if (!visitor(node)) return false;
+			for (node = node->child_R; node != nullptr; node = node->child_L) {
+				stack.push_back(node);
+			}
+		}
+		return true;
+	}
+	
+	//! Traverses the values in order and returns the nodes holding them.
+	std::vector<c_BinaryNode<NodeData>*> traverseInOrder() const {
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		output.reserve(this->size());
+		this->visitInOrder(c_AppendNodes<NodeData>{output});
+		return output;
+	}
+	//! Returns the nodes holding the values from @c low to @c high (both inclusive), in order.
+	std::vector<c_BinaryNode<NodeData>*> traverseRange(const NodeData& low, const NodeData& high) const {
+		std::vector<c_BinaryNode<NodeData>*> output = {};
+		this->visitRange(low, high, c_AppendNodes<NodeData>{output});
+		return output;
+	}
+};
+
+//! Storage order of the nodes of a c_ImplicitTree.
+enum class e_TreeLayout : uint8_t {
+	Eytzinger,	//!< Level order, which is also the order of the tree indexes: the node with index i sits at position i - 1.
+	VanEmdeBoas	//!< Recursive blocks: the top half of the levels is stored first, followed by each subtree below it, all laid out the same way.
+};
+
+/********!
+ * @class c_ImplicitTree
+ *
+ * @brief
+ * Pointer-free form of a complete (full) binary tree, in which every node's value is held in one contiguous array and its
+ * links are implied by its tree index, numbered the same way as c_BinaryTree::generateFull: the children of node i are
+ * 2i and 2i + 1, and its parent is i / 2. Lookups and traversals are arithmetic, and no node is allocated on its own.
+ *
+ * @details
+ * In the Eytzinger layout, the array is in level order, so a Level-Order traversal is a linear scan. The van Emde Boas
+ * layout instead keeps each small subtree in a block of its own, at every scale, so a path from the root to a leaf touches
+ * O(log_B n) cache lines of B nodes rather than one per level once the tree is deep. A path is followed through per-level
+ * tables: a node at depth d lies in the bottom half of the block rooted at depth @c top_depth[d], whose top half holds
+ * @c top_size[d] nodes, and each subtree in that bottom half holds @c bottom_size[d] nodes.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+template<typename NodeData> class c_ImplicitTree {
+	std::vector<NodeData> values;
+	uint8_t treeHeight = 0;
+	e_TreeLayout order = e_TreeLayout::Eytzinger;
+	uint32_t top_size[33] = {}, bottom_size[33] = {}, top_depth[33] = {}; // By depth, from 1 at the root (van Emde Boas only).
+
+	// Position of a node along the path from the root: the path's index and depth, and the position of each node on it.
+	struct c_Cursor {
+		uint32_t index = 1, depth = 1, position[33];
+		c_Cursor() noexcept {
+			this->position[1] = 0;
+		}
+	};
+	// Fills in the tables for the block of the specified height whose root is at the specified depth.
+	void buildTables(uint32_t depth, uint32_t height) noexcept {
+		if (height <= 1) {
+			return;
+		}
+		const uint32_t top = height / 2, bottom = height - top;
+		this->top_depth[depth + top] = depth;
+		this->top_size[depth + top] = (1u << top) - 1;
+		this->bottom_size[depth + top] = (1u << bottom) - 1;
+		this->buildTables(depth, top);
+		this->buildTables(depth + top, bottom);
+	}
+	// Moves the cursor to the left (or right) child of its node.
+	void toChild(c_Cursor& at, bool right) const noexcept {
+		at.index = (at.index << 1) | (right ? 1 : 0);
+		at.depth++;
+		if (this->order == e_TreeLayout::Eytzinger) {
+			at.position[at.depth] = at.index - 1;
+		} else {
+			const uint32_t d = at.depth;
+			at.position[d] = at.position[this->top_depth[d]] + this->top_size[d] + ((at.index & this->top_size[d]) * this->bottom_size[d]);
+		}
+	}
+	// Moves the cursor to the parent of its node.
+	static void toParent(c_Cursor& at) noexcept {
+		at.index >>= 1;
+		at.depth--;
+	}
+	// Moves the cursor down to the leftmost (or rightmost) leaf below its node.
+	void toLeaf(c_Cursor& at, bool right) const noexcept {
+		while (at.depth < this->treeHeight) {
+			this->toChild(at, right);
+		}
+	}
+	// Shared implementation of the In-Order (left) and Reverse-Order traversals.
+	template<typename Visitor> bool visitOrdered(Visitor& visitor, bool left) {
+		if (this->treeHeight == 0) {
+			return true;
+		}
+		c_Cursor at;
+		this->toLeaf(at, !left);
+		while (true) {
+			if (!visitor(at.index, this->values[at.position[at.depth]])) {
+				return false;
+			}
+			if (at.depth < this->treeHeight) {
+				this->toChild(at, left);
+				this->toLeaf(at, !left);
+				continue;
+			}
+			// Climb past every node whose later subtree has been finished; the first one left behind comes next.
+			while ((at.depth > 1) && ((at.index & 1) == (left ? 1u : 0u))) {
+				toParent(at);
+			}
+			if (at.depth == 1) {
+				return true;
+			}
+			toParent(at);
+		}
+	}
+public:
+	/********!
+	 * @brief
+	 *  	Overwrites the entire object with a complete binary tree of the specified height, which holds (pow(2, height) - 1)
+	 *  	nodes that all contain the same value, indexed in the same fashion as c_BinaryTree::generateFull.
+	 * @param [in] height
+	 *  	Height of the binary tree to generate, up to 31.
+	 * @param [in] prefill
+	 *  	The default value to set all nodes to.
+	 * @param [in] layout
+	 *  	The order in which the nodes are stored.
+	 ********/
+	void generateFull(uint8_t height, const NodeData prefill, e_TreeLayout layout = e_TreeLayout::Eytzinger) {
+		if (height > 31) height = 31;
+		this->treeHeight = height;
+		this->order = layout;
+		this->values.assign((height == 0) ? 0 : ((1u << height) - 1), prefill);
+		if (layout == e_TreeLayout::VanEmdeBoas) {
+			this->buildTables(1, height);
+		}
+	}
+	//! Returns the height of the tree.
+	uint8_t height() const noexcept {
+		return this->treeHeight;
+	}
+	//! Returns the number of nodes in the tree.
+	uint32_t size() const noexcept {
+		return this->values.size();
+	}
+	//! Returns the order in which the nodes are stored.
+	e_TreeLayout layout() const noexcept {
+		return this->order;
+	}
+	//! Returns TRUE if a node with the specified tree index exists.
+	bool contains(uint32_t index) const noexcept {
+		return (index != 0) && (index <= this->values.size());
+	}
+	//! Returns the tree index of the left child of the specified node (which exists if contains() says so).
+	static uint32_t leftChild(uint32_t index) noexcept {
+		return index << 1;
+	}
+	//! Returns the tree index of the right child of the specified node (which exists if contains() says so).
+	static uint32_t rightChild(uint32_t index) noexcept {
+		return (index << 1) | 1;
+	}
+	//! Returns the tree index of the parent of the specified node, or zero for the root.
+	static uint32_t parent(uint32_t index) noexcept {
+		return index >> 1;
+	}
+	//! Returns the depth of the specified node, from 1 at the root.
+	static uint32_t depthOf(uint32_t index) noexcept {
+		uint32_t depth = 0;
+		for (; index != 0; index >>= 1) depth++;
+		return depth;
+	}
+	//! Returns the position within the storage array of the node with the specified tree index, which must exist. Runs in
+	//! O(1) time in the Eytzinger layout, and in O(depth) time in the van Emde Boas layout.
+	uint32_t position(uint32_t index) const noexcept {
+		if (this->order == e_TreeLayout::Eytzinger) {
+			return index - 1;
+		}
+		const uint32_t depth = depthOf(index);
+		c_Cursor at;
+		for (uint32_t d = depth - 1; d > 0; d--) {
+			this->toChild(at, (index >> (d - 1)) & 1);
+		}
+		return at.position[depth];
+	}
+	//! Returns the value of the node with the specified tree index, which must exist.
+	NodeData& at(uint32_t index) noexcept {
+		return this->values[this->position(index)];
+	}
+	//! Returns the value of the node with the specified tree index, which must exist.
+	const NodeData& at(uint32_t index) const noexcept {
+		return this->values[this->position(index)];
+	}
+	//! Allows read-only access to the storage array, in the order of the layout.
+	const std::vector<NodeData>& data() const noexcept {
+		return this->values;
+	}
+
+	/********!
+	 * @brief
+	 *  	Follows a single path down from the root, such as a search, handing each node's index and value to the visitor,
+	 *  	which decides where to go next. This is the access pattern that the van Emde Boas layout is meant for.
+	 * @param [in] visitor
+	 *  	Callable taking a tree index and a reference to its value, which returns a negative number to continue to the left
+	 *  	child, a positive number to continue to the right child, or zero to stop at the current node.
+	 * @return
+	 *  	The tree index of the node that the path stopped at (a leaf, if the visitor never stopped it), or zero if the tree
+	 *  	is empty.
+	 ********/
+	template<typename Visitor> uint32_t visitPath(Visitor visitor) {
+		if (this->treeHeight == 0) {
+			return 0;
+		}
+		c_Cursor at;
+		while (true) {
+			const int direction = visitor(at.index, this->values[at.position[at.depth]]);
+			if ((direction == 0) || (at.depth == this->treeHeight)) {
+				return at.index;
+			}
+			this->toChild(at, direction > 0);
+		}
+	}
+	/********!
+	 * @brief
+	 *  	Traverses the entire structure in a Level-Order (Breadth-First) fashion, handing each node's index and value to
+	 *  	the visitor. In the Eytzinger layout, this is a linear scan of the storage array.
+	 * @param [in] visitor
+	 *  	Callable taking a tree index and a reference to its value, which returns TRUE to continue the traversal or FALSE
+	 *  	to stop it.
+	 * @return
+	 *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it.
+	 ********/
+	template<typename Visitor> bool visitBreadth(Visitor visitor) {
+		for (uint32_t i=1; i <= this->values.size(); i++) {
+			if (!visitor(i, (this->order == e_TreeLayout::Eytzinger) ? this->values[i - 1] : this->at(i))) {
+				return false;
+			}
+		}
+		return true;
+	}
+	//! Traverses the entire structure in an In-Order fashion, handing each node's index and value to the visitor (which
+	//! returns FALSE to stop). Runs iteratively in O(1) amortized time per node.
+	template<typename Visitor> bool visitInOrder(Visitor visitor) {
+		return this->visitOrdered(visitor, true);
+	}
+	//! Traverses the entire structure in a Reverse-Order fashion, handing each node's index and value to the visitor (which
+	//! returns FALSE to stop).
+	template<typename Visitor> bool visitRevOrder(Visitor visitor) {
+		return this->visitOrdered(visitor, false);
+	}
+	//! Traverses the entire structure in a Pre-Order fashion, handing each node's index and value to the visitor (which
+	//! returns FALSE to stop).
+	template<typename Visitor> bool visitPreOrder(Visitor visitor) {
+		if (this->treeHeight == 0) {
+			return true;
+		}
+		c_Cursor at;
+		while (true) {
+			if (!visitor(at.index, this->values[at.position[at.depth]])) {
+				return false;
+			}
+			if (at.depth < this->treeHeight) {
+				this->toChild(at, false);
+				continue;
+			}
+			// Climb out of every finished right subtree, then move over to the right sibling.
+			while ((at.depth > 1) && (at.index & 1)) {
+				toParent(at);
+			}
+			if (at.depth == 1) {
+				return true;
+			}
+			toParent(at);
+			this->toChild(at, true);
+		}
+	}
+	//! Traverses the entire structure in a Post-Order fashion, handing each node's index and value to the visitor (which
+	//! returns FALSE to stop).
+	template<typename Visitor> bool visitPostOrder(Visitor visitor) {
+		if (this->treeHeight == 0) {
+			return true;
+		}
+		c_Cursor at;
+		this->toLeaf(at, false);
+		while (true) {
+			if (!visitor(at.index, this->values[at.position[at.depth]])) {
+				return false;
+			}
+			if (at.depth == 1) {
+				return true;
+			}
+			// A left child is followed by the leftmost leaf of its sibling's subtree, and a right child by its parent.
+			const bool wasLeft = !(at.index & 1);
+			toParent(at);
+			if (wasLeft) {
+				this->toChild(at, true);
+				this->toLeaf(at, false);
+			}
+		}
+	}
+};
 }
 #endif
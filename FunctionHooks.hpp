@@ -1,8 +1,205 @@
 #ifndef ERC_FUNCHOOK
 #define ERC_FUNCHOOK
 
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
+// Define ERC_FUNCHOOK_PROFILE before including this header to record the call counts and times of every hook, which needs
+// <atomic>, <chrono> and <mutex>. Without it, none of the profiling is compiled in.
+#ifdef ERC_FUNCHOOK_PROFILE
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+//! Totals recorded for one hook (or for the original function) of a chain, with the times in nanoseconds.
+struct c_HookStats {
+	uint64_t calls = 0;
+	uint64_t short_circuits = 0;		//!< Calls that returned without the original function being reached.
+	uint64_t inclusive_ns = 0;			//!< Time spent in the hook, including the levels it invoked.
+	uint64_t exclusive_ns = 0;			//!< Time spent in the hook itself, excluding the levels it invoked.
+	uint64_t max_inclusive_ns = 0;
+	uint64_t max_exclusive_ns = 0;
+};
+
+//! Totals recorded for a chain: one entry per hook, in the order they run, and one for the original function.
+struct c_HookProfile {
+	std::vector<c_HookStats> hooks;
+	c_HookStats original;
+};
+
+/********!
+* @class c_HookProfiler
+* 
+* @date 14 October 2026
+* 
+* @brief
+* Records the calls and times of each level of a chain of hooks. Every thread records into its own block of counters, which
+* only it writes, so recording takes no locks and shares no cache lines; read() adds the blocks of every thread together.
+*
+* @note
+* Levels are counted by position, so removing a hook moves the counts of the hooks after it onto the ones that take their
+* place. Only the first @c max_levels hooks of a chain are recorded; deeper ones count towards the hook that invoked them.
+********/
+class c_HookProfiler {
+	struct c_Counters {
+		std::atomic<uint64_t> calls{0}, short_circuits{0}, inclusive{0}, exclusive{0}, max_inclusive{0}, max_exclusive{0};
+	};
+	struct c_Frame {
+		uint64_t start, children, reached;
+	};
+public:
+	//! Number of hook levels recorded.
+	static constexpr uint32_t max_levels = 64;
+	//! Level to record the original function as, which has its own counters after those of the hooks.
+	static constexpr uint32_t original_level = (uint32_t)(-1);
+private:
+	// The counters of one thread, with its stack of levels in progress and the number of times it reached the original.
+	struct c_Block {
+		c_Counters counters[max_levels + 1];
+		std::vector<c_Frame> frames;
+		uint64_t reached = 0;
+	};
+	const uint64_t id;
+	const uint32_t slot;
+	mutable std::mutex lock;
+	mutable std::vector<c_Block*> blocks;
+	
+	static uint64_t now() noexcept {
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+	// Only the owning thread writes a counter, so it needs no read-modify-write; the atomics just make the reads safe.
+	static void add(std::atomic<uint64_t>& counter, uint64_t amount) noexcept {
+		counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+	}
+	static void raise(std::atomic<uint64_t>& counter, uint64_t value) noexcept {
+		if (value > counter.load(std::memory_order_relaxed)) counter.store(value, std::memory_order_relaxed);
+	}
+	static std::atomic<uint64_t>& lastId() noexcept {
+		static std::atomic<uint64_t> last(0);
+		return last;
+	}
+	// Hands out the slots that the threads index their blocks by. A destroyed profiler gives its slot back for reuse, so
+	// the slots (and the per-thread tables) stay as small as the number of profilers alive at once.
+	struct c_Slots {
+		std::mutex lock;
+		std::vector<uint32_t> free;
+		uint32_t next = 0;
+	};
+	static c_Slots& slots() {
+		static c_Slots all;
+		return all;
+	}
+	static uint32_t takeSlot() {
+		c_Slots& all = slots();
+		std::lock_guard<std::mutex> guard(all.lock);
+		if (all.free.empty()) {
+			return all.next++;
+		}
+		const uint32_t taken = all.free.back();
+		all.free.pop_back();
+		return taken;
+	}
+	// Returns the block of the calling thread, creating it on first use. Each thread keeps its blocks in a table indexed
+	// by the slot of their profiler, tagged with the profiler's unique ID, which is never reused: an entry left behind by a
+	// destroyed profiler is never matched, and is overwritten by the next profiler given the same slot.
+	c_Block* threadBlock() const {
+		struct c_Entry {
+			uint64_t id = 0;
+			c_Block* block = nullptr;
+		};
+		thread_local std::vector<c_Entry> known;
+		if ((this->slot < known.size()) && (known[this->slot].id == this->id)) {
+			return known[this->slot].block;
+		}
+		c_Block* block = new c_Block();
+		{
+			std::lock_guard<std::mutex> guard(this->lock);
+			this->blocks.push_back(block);
+		}
+		if (this->slot >= known.size()) {
+			known.resize(this->slot + 1);
+		}
+		known[this->slot] = {this->id, block};
+		return block;
+	}
+	static void collect(c_HookStats& into, const c_Counters& from) noexcept {
+		into.calls += from.calls.load(std::memory_order_relaxed);
+		into.short_circuits += from.short_circuits.load(std::memory_order_relaxed);
+		into.inclusive_ns += from.inclusive.load(std::memory_order_relaxed);
+		into.exclusive_ns += from.exclusive.load(std::memory_order_relaxed);
+		const uint64_t maxInclusive = from.max_inclusive.load(std::memory_order_relaxed), maxExclusive = from.max_exclusive.load(std::memory_order_relaxed);
+		if (maxInclusive > into.max_inclusive_ns) into.max_inclusive_ns = maxInclusive;
+		if (maxExclusive > into.max_exclusive_ns) into.max_exclusive_ns = maxExclusive;
+	}
+public:
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Records one run of a level of the chain, from its construction to its destruction.
+	 ********/
+	class c_Scope {
+		c_Block* block;
+		uint32_t level;
+	public:
+		c_Scope(const c_HookProfiler& profiler, uint32_t at)
+			: block(((at < max_levels) || (at == original_level)) ? profiler.threadBlock() : nullptr), level((at == original_level) ? max_levels : at) {
+			if (this->block == nullptr) return;
+			if (this->level == max_levels) this->block->reached++;
+			this->block->frames.push_back({now(), 0, this->block->reached});
+		}
+		c_Scope(const c_Scope&) = delete;
+		c_Scope& operator=(const c_Scope&) = delete;
+		~c_Scope() {
+			if (this->block == nullptr) return;
+			const c_Frame frame = this->block->frames.back();
+			this->block->frames.pop_back();
+			const uint64_t inclusive = now() - frame.start, exclusive = inclusive - frame.children;
+			if (!this->block->frames.empty()) this->block->frames.back().children += inclusive;
+			c_Counters& counters = this->block->counters[this->level];
+			add(counters.calls, 1);
+			add(counters.inclusive, inclusive);
+			add(counters.exclusive, exclusive);
+			raise(counters.max_inclusive, inclusive);
+			raise(counters.max_exclusive, exclusive);
+			if ((this->level != max_levels) && (this->block->reached == frame.reached)) add(counters.short_circuits, 1);
+		}
+	};
+	
+	c_HookProfiler() : id(lastId().fetch_add(1, std::memory_order_relaxed) + 1), slot(takeSlot()) {}
+	//! A copy starts out with no counts of its own, so that copying a hook object does not share or split its counts.
+	c_HookProfiler(const c_HookProfiler&) : c_HookProfiler() {}
+	//! Assigning leaves the counts of both profilers where they are.
+	c_HookProfiler& operator=(const c_HookProfiler&) noexcept {
+		return *this;
+	}
+	//! Deletes the blocks of every thread, which must no longer be recording, and gives the slot back.
+	~c_HookProfiler() {
+		for (c_Block* i : this->blocks) {
+			delete i;
+		}
+		c_Slots& all = slots();
+		std::lock_guard<std::mutex> guard(all.lock);
+		all.free.push_back(this->slot);
+	}
+	//! Adds together the counters of every thread, for the specified number of hooks and the original function.
+	c_HookProfile read(uint32_t hooks) const {
+		c_HookProfile profile;
+		profile.hooks.resize((hooks < max_levels) ? hooks : max_levels);
+		std::lock_guard<std::mutex> guard(this->lock);
+		for (const c_Block* i : this->blocks) {
+			for (uint32_t j=0; j < profile.hooks.size(); j++) {
+				collect(profile.hooks[j], i->counters[j]);
+			}
+			collect(profile.original, i->counters[max_levels]);
+		}
+		return profile;
+	}
+};
+#endif
+
 /********!
 * @class c_FuncHook_Typed
 * 
@@ -31,6 +228,9 @@
 * how modules would interface with particular parts of your code. It would work well for keeping modules "constrained,"
 * especially for open-source projects or for game modding, where you can't truly be confident in the stability of modules.
 *
+* The hooks share the object's position in the chain, so only one call can be in progress at a time. For hooks that serve
+* several threads at once, or calls made from within the hooks, see c_FuncHook_Shared in FunctionHooksShared.hpp.
+*
 * @note
 * Successful implementation of this system is largely a developer-dependent process regarding the design and stability of
 * the hooked functions used. Due to the inherent nature of using function pointers, very little data safety is possible on
@@ -44,6 +244,9 @@ private:
 	std::vector<HookForm> registered_hooks;
 	uint32_t current_hook = 0, max_hook = 0;
 	Returns (*const original)(Params...);
+#ifdef ERC_FUNCHOOK_PROFILE
+	c_HookProfiler profiler;
+#endif
 public:
 	/********!
 	 * @date	24 October 2024
@@ -75,6 +278,34 @@ public:
 		}
 		return false;
 	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Unregisters the first registration of the specified hook.
+	 * @param [in] oldhook
+	 * 		Pointer to a function previously registered with addHook().
+	 * @return
+	 *		Returns TRUE if the hook was registered, and has been removed.
+	 * @note
+	 *		Like addHook(), this must not be used while a call() is in progress.
+	 ********/
+	bool removeHook(const HookForm oldhook) {
+		for (uint32_t i=0; i < max_hook; i++) {
+			if (registered_hooks[i] == oldhook) {
+				registered_hooks.erase(registered_hooks.begin() + i);
+				max_hook -= 1;
+				return true;
+			}
+		}
+		return false;
+	}
+	
+#ifdef ERC_FUNCHOOK_PROFILE
+	//! Returns the call counts and times recorded by call() for each hook registered with addHook(), and the original.
+	c_HookProfile profile() const {
+		return this->profiler.read(this->max_hook);
+	}
+#endif
 	
 	/********!
 	 * @date	25 October 2024
@@ -92,8 +323,7 @@ public:
 	Returns call(Params... parameters) {
 		try {
 			current_hook = 0;
-			Returns output = this->invoke(parameters...);
-			return output;
+			return this->invoke(parameters...);
 		} catch (void* obj) {
 			current_hook = 0;
 			return this->original(parameters...);
@@ -112,15 +342,19 @@ public:
 	 *		such that they can invoke the next level function as needed.
 	 ********/
 	Returns invoke(Params... parameters) {
-		Returns value;
+		// The value is returned straight from the next level, so Returns need not be default-constructible or assignable.
 		if (current_hook != max_hook) {
 			Returns (*callable)(c_FuncHook_Typed<Returns, Params...>* const, Params...) = this->registered_hooks.at(current_hook);
 			current_hook++;
-			value = callable(this, parameters...);
-		} else {
-			value = this->original(parameters...);
+#ifdef ERC_FUNCHOOK_PROFILE
+			const c_HookProfiler::c_Scope scope(this->profiler, current_hook - 1);
+#endif
+			return callable(this, parameters...);
 		}
-		return value;
+#ifdef ERC_FUNCHOOK_PROFILE
+		const c_HookProfiler::c_Scope scope(this->profiler, c_HookProfiler::original_level);
+#endif
+		return this->original(parameters...);
 	}
 };
 
@@ -143,6 +377,9 @@ private:
 	std::vector<HookForm> registered_hooks;
 	uint32_t current_hook = 0, max_hook = 0;
 	void (* const original)(Params...);
+#ifdef ERC_FUNCHOOK_PROFILE
+	c_HookProfiler profiler;
+#endif
 public:
 	/********!
 	 * @date	25 October 2024
@@ -173,6 +410,34 @@ public:
 		}
 		return false;
 	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Unregisters the first registration of the specified hook.
+	 * @param [in] oldhook
+	 * 		Pointer to a function previously registered with addHook().
+	 * @return
+	 *		Returns TRUE if the hook was registered, and has been removed.
+	 * @note
+	 *		Like addHook(), this must not be used while a call() is in progress.
+	 ********/
+	bool removeHook(const HookForm oldhook) {
+		for (uint32_t i=0; i < max_hook; i++) {
+			if (registered_hooks[i] == oldhook) {
+				registered_hooks.erase(registered_hooks.begin() + i);
+				max_hook -= 1;
+				return true;
+			}
+		}
+		return false;
+	}
+#ifdef ERC_FUNCHOOK_PROFILE
+	//! Returns the call counts and times recorded by call() for each hook registered with addHook(), and the original.
+	c_HookProfile profile() const {
+		return this->profiler.read(this->max_hook);
+	}
+#endif
+	
 	/********!
 	 * @date	25 October 2024
 	 * @brief
@@ -208,14 +473,90 @@ public:
 		if (current_hook != max_hook) {
 			void (*callable)(c_FuncHook_Void<Params...>* const, Params...) = this->registered_hooks.at(current_hook);
 			current_hook++;
+#ifdef ERC_FUNCHOOK_PROFILE
+			const c_HookProfiler::c_Scope scope(this->profiler, current_hook - 1);
+#endif
 			callable(this, parameters...);
 		} else {
+#ifdef ERC_FUNCHOOK_PROFILE
+			const c_HookProfiler::c_Scope scope(this->profiler, c_HookProfiler::original_level);
+#endif
 			this->original(parameters...);
 		}
 		return;
 	}
 };
 
+/********!
+* @class c_FuncHook_Static
+* 
+* @date 14 October 2026
+* 
+* @brief
+* Compile-time counterpart of c_FuncHook_Typed and c_FuncHook_Void, for hooks that are fixed when the program is built.
+* The original function and the hooks are template arguments, so call() resolves the whole chain at compile time and each
+* level is a direct (and inlinable) call instead of an indirect call through a vector of function pointers.
+* 
+* @details
+* Instead of function pointers, the hooks are types, each with a static member function template @c hook. Its first
+* parameter is the rest of the chain (an object of some type @c Next), followed by the parameters of the original
+* function, and it must return the same type as the original. Like the runtime hooks, each one is expected to invoke the
+* next level with @c next.invoke(...), unless it means to override the rest of the chain. For example:
+* @code
+struct AddTwo {
+	template<typename Next> static int hook(const Next& next, int A, int B) {
+		return next.invoke(A + 2, B);
+	}
+};
+using MainFunctionChain = c_FuncHook_Static<MainFunction, AddTwo, Hook2>;
+int output = MainFunctionChain::call(1, 1);
+* @endcode
+* Void-returning functions work the same way, with hooks that return void.
+*
+* @note
+* There is no failsafe around the chain, unlike the runtime versions: exceptions thrown by the hooks or the original are
+* passed on to the caller. Since the chain holds no state, calls from several threads or from within a hook are safe.
+********/
+template<auto Original, typename Signature, typename... Hooks> class c_FuncHook_StaticChain;
+
+template<auto Original, typename Returns, typename... Params, typename... Hooks> class c_FuncHook_StaticChain<Original, Returns (*)(Params...), Hooks...> {
+public:
+	//! The rest of the chain after the specified number of hooks, which is handed to the hook at that level.
+	template<uint32_t Level> struct c_Next {
+		//! Invokes the next hook of the chain, or the original function after the last one, forwarding the arguments as they
+		//! were given (so a hook taking references can pass them on without copies).
+		template<typename... Args> Returns invoke(Args&&... parameters) const {
+			if constexpr (Level == sizeof...(Hooks)) {
+				return Original(std::forward<Args>(parameters)...);
+			} else {
+				return std::tuple_element_t<Level, std::tuple<Hooks...>>::hook(c_Next<Level + 1>{}, std::forward<Args>(parameters)...);
+			}
+		}
+	};
+	//! Number of hooks in the chain.
+	static constexpr uint32_t hooks = sizeof...(Hooks);
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Initiates the execution of all of the hooked functions, in order, assuming that each level's hook invokes the next.
+	 * @param [in] parameters
+	 *  	Packed parameters, as specified by the parameters of the original function, to pass to all hooked functions.
+	 * @return
+	 *		Returns an output of the original function's return type, as dependent on the hooks and original function.
+	 ********/
+	static Returns call(Params... parameters) {
+		return c_Next<0>{}.invoke(std::forward<Params>(parameters)...);
+	}
+};
+
+//! Chain for a function that is declared noexcept, which is otherwise the same.
+template<auto Original, typename Returns, typename... Params, typename... Hooks> class c_FuncHook_StaticChain<Original, Returns (*)(Params...) noexcept, Hooks...>
+	: public c_FuncHook_StaticChain<Original, Returns (*)(Params...), Hooks...> {};
+
+//! Compile-time hook chain for the original function, with the hooks applied in the order given (see c_FuncHook_StaticChain).
+template<auto Original, typename... Hooks> using c_FuncHook_Static = c_FuncHook_StaticChain<Original, decltype(Original), Hooks...>;
+
 /********!
 * @example
 * The following code is an example use of the FuncHookHandler with two hooked functions executing in a different order.
@@ -0,0 +1,388 @@
+#ifndef ERC_FUNCHOOK_SHARED
+#define ERC_FUNCHOOK_SHARED
+
+#include "FunctionHooks.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+// Hooks that can serve several threads at once. They are kept apart from FunctionHooks.hpp so that the classic hook objects
+// stay small and copyable, and do not need the threading headers.
+
+/********!
+* @class c_HookRegistry
+* 
+* @date 14 October 2026
+* 
+* @brief
+* List of hooks that can be changed while other threads are running through it, using read-copy-update. Each change copies
+* the list, edits the copy, and publishes it with one atomic store, so a reader always sees one complete version of the
+* list and never waits. The replaced version is deleted once every reader that may have seen it has left.
+* 
+* @details
+* Readers announce themselves on one of a few counters (chosen per thread, to keep them from sharing a cache line) for the
+* current epoch. A writer publishes its copy, moves the epoch on, and waits for the counters of the previous epoch to empty
+* before deleting the version it replaced; readers arriving after that use the other set of counters. Writers take a mutex,
+* so they only ever wait for readers and for each other.
+*
+* @note
+* A reader must not change the registry it is reading (for example, a hook must not add or remove hooks of the function it
+* is hooked into), since the change would wait for that reader to leave.
+********/
+template<typename Hook, typename Final> class c_HookRegistry {
+public:
+	//! One published version of the list, which is never changed once published. It also carries the function to run after
+	//! the last hook, so that a reader needs nothing besides its version.
+	struct c_Snapshot {
+		std::vector<Hook> hooks;
+		Final final;
+#ifdef ERC_FUNCHOOK_PROFILE
+		const c_HookProfiler* profiler = nullptr;
+#endif
+	};
+	//! Marks the calling thread as reading the registry for as long as it exists, and holds the version it sees.
+	class c_Reader {
+		std::atomic<uint32_t>* counter;
+		const c_Snapshot* snapshot;
+	public:
+		explicit c_Reader(const c_HookRegistry<Hook, Final>& registry) noexcept {
+			const uint32_t shard = threadShard();
+			uint32_t epoch = registry.epoch.load();
+			while (true) {
+				this->counter = &registry.readers[epoch & 1][shard].count;
+				this->counter->fetch_add(1);
+				const uint32_t check = registry.epoch.load();
+				if (check == epoch) break;
+				// A writer moved the epoch on in the meantime, and may already be waiting on the other counters.
+				this->counter->fetch_sub(1);
+				epoch = check;
+			}
+			this->snapshot = registry.current.load();
+		}
+		c_Reader(const c_Reader&) = delete;
+		c_Reader& operator=(const c_Reader&) = delete;
+		~c_Reader() {
+			this->counter->fetch_sub(1, std::memory_order_release);
+		}
+		//! Returns the version of the list seen by this reader.
+		const c_Snapshot* hooks() const noexcept {
+			return this->snapshot;
+		}
+	};
+	
+	//! Construct the registry with an empty list, ending in the specified function.
+	explicit c_HookRegistry(const Final final) {
+		c_Snapshot* first = new c_Snapshot{{}, final};
+#ifdef ERC_FUNCHOOK_PROFILE
+		first->profiler = &this->profiler;
+#endif
+		this->current.store(first);
+	}
+	c_HookRegistry(const c_HookRegistry&) = delete;
+	c_HookRegistry& operator=(const c_HookRegistry&) = delete;
+	~c_HookRegistry() {
+		delete this->current.load();
+	}
+	
+	//! Publishes a copy of the list with the specified hook added to the end. Returns TRUE if the hook was non-null.
+	bool add(const Hook hook) {
+		if (hook == nullptr) {
+			return false;
+		}
+		std::lock_guard<std::mutex> lock(this->writer);
+		c_Snapshot* next = new c_Snapshot(*this->current.load());
+		next->hooks.push_back(hook);
+		this->publish(next);
+		return true;
+	}
+	//! Publishes a copy of the list without the first occurrence of the specified hook. Returns TRUE if it was present.
+	bool remove(const Hook hook) {
+		std::lock_guard<std::mutex> lock(this->writer);
+		const c_Snapshot* old = this->current.load();
+		for (uint32_t i=0; i < old->hooks.size(); i++) {
+			if (old->hooks[i] == hook) {
+				c_Snapshot* next = new c_Snapshot(*old);
+				next->hooks.erase(next->hooks.begin() + i);
+				this->publish(next);
+				return true;
+			}
+		}
+		return false;
+	}
+	//! Returns the number of hooks in the current version of the list.
+	uint32_t size() const noexcept {
+		c_Reader reader(*this);
+		return reader.hooks()->hooks.size();
+	}
+#ifdef ERC_FUNCHOOK_PROFILE
+	//! Returns the totals recorded for the current list of hooks and the function after them.
+	c_HookProfile profile() const {
+		return this->profiler.read(this->size());
+	}
+#endif
+private:
+	static constexpr uint32_t shards = 16;
+	struct alignas(64) c_Shard {
+		std::atomic<uint32_t> count{0};
+	};
+	std::atomic<const c_Snapshot*> current;
+	std::atomic<uint32_t> epoch{0};
+	mutable c_Shard readers[2][shards];
+	std::mutex writer;
+#ifdef ERC_FUNCHOOK_PROFILE
+	c_HookProfiler profiler;
+#endif
+	
+	// Returns the counter shard of the calling thread, handed out in turn as threads first read any registry.
+	static uint32_t threadShard() noexcept {
+		static std::atomic<uint32_t> assigned(0);
+		thread_local const uint32_t shard = assigned.fetch_add(1, std::memory_order_relaxed) % shards;
+		return shard;
+	}
+	// Publishes the new version (held by the writer), then deletes the old one once its readers have left.
+	void publish(const c_Snapshot* next) {
+		const c_Snapshot* old = this->current.exchange(next);
+		const uint32_t previous = this->epoch.fetch_add(1) & 1;
+		for (uint32_t i=0; i < shards; i++) {
+			while (this->readers[previous][i].count.load() != 0) {
+				std::this_thread::yield();
+			}
+		}
+		delete old;
+	}
+};
+
+/********!
+* @class c_FuncHook_Shared
+* 
+* @date 14 October 2026
+* 
+* @brief
+* Variant of c_FuncHook_Typed and c_FuncHook_Void in which the position in the chain travels with each call instead of being
+* kept by the object: every hook is handed the position of its own call (a c_Context), through which it invokes the next
+* level. One object can therefore serve any number of threads at once, as well as calls made from within its own hooks, and
+* hooks can be added and removed while those calls are running (see c_HookRegistry). Void-returning functions use the same
+* class.
+* @code
+int Doubled(c_FuncHook_Shared<int, int>::c_Context next, int A) {
+	return 2 * next.invoke(A);
+}
+* @endcode
+********/
+template<typename Returns, typename... Params> class c_FuncHook_Shared {
+public:
+	class c_Context;
+	//! Templated type-alias for valid shared function hooks.
+	using HookForm = Returns (*)(c_Context, Params...);
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Position of one call within the chain of hooks, which is handed to each hook so that it can invoke the next level.
+	 *  	Each call has its own, so calls never disturb each other. It is only two words, and is passed by value.
+	 ********/
+	class c_Context {
+		const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Snapshot* snapshot;
+		uint32_t level;
+	public:
+		c_Context(const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Snapshot* const hooks, uint32_t next)
+			: snapshot(hooks), level(next) {}
+		//! Initiates the execution of the next pending hook, or the original function.
+		Returns invoke(Params... parameters) const {
+			if (this->level != this->snapshot->hooks.size()) {
+#ifdef ERC_FUNCHOOK_PROFILE
+				const c_HookProfiler::c_Scope scope(*this->snapshot->profiler, this->level);
+#endif
+				return this->snapshot->hooks[this->level](c_Context(this->snapshot, this->level + 1), parameters...);
+			}
+#ifdef ERC_FUNCHOOK_PROFILE
+			const c_HookProfiler::c_Scope scope(*this->snapshot->profiler, c_HookProfiler::original_level);
+#endif
+			return this->snapshot->final(parameters...);
+		}
+	};
+private:
+	c_HookRegistry<HookForm, Returns (*)(Params...)> hooks;
+	Returns (* const original)(Params...);
+public:
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Constructs a templated c_FuncHook_Shared hook wrapper for the specified "original" function.
+	 * @param [in] initial
+	 *  	Function pointer to the original function for which hooks will be applied; function must take the same
+	 * 		sequence of parameters as specified in the template parameter @c Params, and must return the same type as
+	 * 		specified in the template parameter @c Returns, and must not be volatile or ephemeral.
+	 ********/
+	c_FuncHook_Shared(Returns (* const initial)(Params...)) : hooks(initial), original(initial) {}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Registers the specified function as a hook, to be executed when the object has its call() method called.
+	 * @param [in] newhook
+	 * 		Pointer to a valid, non-ephemeral function that takes the context of its call as its first parameter, followed
+	 * 		by all of the packed parameters as specified in the template parameter @c Params, and which returns a value of
+	 * 		type @c Returns.
+	 * @return
+	 *		Returns TRUE if the pointer provided was non-null and could be added to the object's list of hooks.
+	 * @note
+	 *		This is safe while other threads are in call(): calls already in progress finish with the hooks they began with,
+	 *		and later ones see the new hook. It only waits for the calls in progress, so it must not be used from within a hook
+	 *		of this object.
+	 ********/
+	bool addHook(const HookForm newhook) {
+		return this->hooks.add(newhook);
+	}
+	//! Unregisters the first registration of the specified hook, in the same way as addHook() registers one. Returns TRUE if
+	//! it was registered.
+	bool removeHook(const HookForm oldhook) {
+		return this->hooks.remove(oldhook);
+	}
+	//! Returns the number of hooks registered.
+	uint32_t size() const noexcept {
+		return this->hooks.size();
+	}
+#ifdef ERC_FUNCHOOK_PROFILE
+	//! Returns the call counts and times recorded for each hook, and for the original.
+	c_HookProfile profile() const {
+		return this->hooks.profile();
+	}
+#endif
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Initiates the execution of all of the hooks, assuming that each level's hook invokes its context at some point in
+	 *		execution. Has a failsafe to execute only the original function if an exception is encountered, as with
+	 *		c_FuncHook_Typed::call().
+	 * @param [in] parameters
+	 *  	Packed parameters, as specified by the template parameter @c Params, to pass to all hooks.
+	 * @return
+	 *		Returns an output of type @c Returns as dependent on the hooks and original function.
+	 ********/
+	Returns call(Params... parameters) const {
+		try {
+			const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Reader reader(this->hooks);
+			return c_Context(reader.hooks(), 0).invoke(parameters...);
+		} catch (void* obj) {
+			return this->original(parameters...);
+		}
+	}
+};
+
+//! Passes an argument on to a hook parameter of type @c Param&&, making a copy only for an lvalue that cannot bind to it.
+template<typename Param, typename Arg> decltype(auto) devPassOn(Arg&& argument) {
+	if constexpr (!std::is_reference<Param>::value && std::is_lvalue_reference<Arg>::value) {
+		return Param(argument);
+	} else {
+		return static_cast<Arg&&>(argument);
+	}
+}
+
+/********!
+* @class c_FuncHook_Forward
+* 
+* @date 14 October 2026
+* 
+* @brief
+* Variant of c_FuncHook_Shared that passes the arguments down the chain by reference instead of by value, for parameters
+* that are expensive to copy. Each hook takes every parameter as an rvalue reference
+* (@c Params&&, which is an lvalue reference for reference parameters), and passes the arguments on by moving them, or
+* by passing new values; the original function, which still takes the parameters as declared, moves them in at the end.
+* The return value is constructed in place by whichever level produces it, so it need not be default-constructible.
+* 
+* @details
+* A hook that calls @c next.invoke() with its own parameter (rather than @c std::move of it) passes a copy, as the value
+* is then still its own; this keeps hooks that read their arguments after invoking the next level correct. As with
+* c_FuncHook_Shared, the position in the chain travels with each call (see c_Context), and hooks can be added and removed
+* while calls are running (see c_HookRegistry). Void-returning functions use the same class.
+* @code
+std::size_t Measure(c_FuncHook_Forward<std::size_t, std::vector<int>>::c_Context next, std::vector<int>&& values) {
+	values.push_back(0);
+	return next.invoke(std::move(values));
+}
+* @endcode
+*
+* @note
+* There is no failsafe to retry the original function, since the arguments may have been moved away by then; exceptions are
+* passed on to the caller.
+********/
+template<typename Returns, typename... Params> class c_FuncHook_Forward {
+public:
+	class c_Context;
+	//! Templated type-alias for valid forwarding hooks.
+	using HookForm = Returns (*)(c_Context, Params&&...);
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Position of one call within the chain of hooks, which is handed to each hook so that it can invoke the next level.
+	 *  	It is only two words, and is passed by value.
+	 ********/
+	class c_Context {
+		const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Snapshot* snapshot;
+		uint32_t level;
+	public:
+		c_Context(const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Snapshot* const hooks, uint32_t next)
+			: snapshot(hooks), level(next) {}
+		//! Initiates the execution of the next pending hook, or the original function, passing the arguments on by reference.
+		template<typename... Args> Returns invoke(Args&&... parameters) const {
+			static_assert(sizeof...(Args) == sizeof...(Params), "invoke() takes the same number of arguments as the function");
+			if (this->level != this->snapshot->hooks.size()) {
+#ifdef ERC_FUNCHOOK_PROFILE
+				const c_HookProfiler::c_Scope scope(*this->snapshot->profiler, this->level);
+#endif
+				return this->snapshot->hooks[this->level](c_Context(this->snapshot, this->level + 1), devPassOn<Params>(std::forward<Args>(parameters))...);
+			}
+#ifdef ERC_FUNCHOOK_PROFILE
+			const c_HookProfiler::c_Scope scope(*this->snapshot->profiler, c_HookProfiler::original_level);
+#endif
+			return this->snapshot->final(std::forward<Args>(parameters)...);
+		}
+	};
+private:
+	c_HookRegistry<HookForm, Returns (*)(Params...)> hooks;
+public:
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Constructs a templated c_FuncHook_Forward hook wrapper for the specified "original" function.
+	 * @param [in] initial
+	 *  	Function pointer to the original function for which hooks will be applied; function must take the same
+	 * 		sequence of parameters as specified in the template parameter @c Params, and must return the same type as
+	 * 		specified in the template parameter @c Returns, and must not be volatile or ephemeral.
+	 ********/
+	c_FuncHook_Forward(Returns (* const initial)(Params...)) : hooks(initial) {}
+	
+	//! Registers the specified function as a hook, which may be done while calls are running. Returns TRUE if it was non-null.
+	bool addHook(const HookForm newhook) {
+		return this->hooks.add(newhook);
+	}
+	//! Unregisters the first registration of the specified hook, which may be done while calls are running. Returns TRUE if
+	//! it was registered.
+	bool removeHook(const HookForm oldhook) {
+		return this->hooks.remove(oldhook);
+	}
+#ifdef ERC_FUNCHOOK_PROFILE
+	//! Returns the call counts and times recorded for each hook, and for the original.
+	c_HookProfile profile() const {
+		return this->hooks.profile();
+	}
+#endif
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Initiates the execution of all of the hooks, assuming that each level's hook invokes its context at some point in
+	 *		execution, passing the arguments down by reference.
+	 * @param [in] parameters
+	 *  	Arguments for the parameters specified by the template parameter @c Params. Arguments passed as rvalues are moved
+	 *		down the chain without copies; each lvalue is copied once, at the start, for a parameter taken by value.
+	 * @return
+	 *		Returns an output of type @c Returns as dependent on the hooks and original function.
+	 ********/
+	template<typename... Args> Returns call(Args&&... parameters) const {
+		const typename c_HookRegistry<HookForm, Returns (*)(Params...)>::c_Reader reader(this->hooks);
+		return c_Context(reader.hooks(), 0).invoke(std::forward<Args>(parameters)...);
+	}
+};
+
+#endif
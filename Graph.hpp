@@ -6,19 +6,37 @@
 #ifndef NODEBUG
 #include <iostream> // debugging only
 
-void dbgprint(const char* what) {
+inline void dbgprint(const char* what) {
 	std::cout << what << '\n';
 	return;
 }
 #else
-void dbgprint(const char* what) {
+inline void dbgprint(const char*) {
 	return;
 }
 #endif
 
 #include <cstdint>
+#include <new>
 #include <vector>
 
+// Define ERC_GRAPH_PARALLEL before including this header to enable the multi-threaded algorithms, which need <thread> and
+// ParallelThreads.hpp.
+#ifdef ERC_GRAPH_PARALLEL
+#include <atomic>
+#include <thread>
+#include "ParallelThreads.hpp"
+#endif
+
+// Define ERC_GRAPH_STATS before including this header to record statistics for the run* traversals (see c_TraversalStats),
+// which need <chrono>, <mutex> and FunctionHooksShared.hpp. Without it, none of the counting is compiled in.
+#ifdef ERC_GRAPH_STATS
+#include <chrono>
+#include <mutex>
+#include <utility>
+#include "FunctionHooksShared.hpp"
+#endif
+
 //! Contains an implementation of a Directed Graph data structure and the two most common traversal methods for it.
 namespace GraphStruct {
 
@@ -37,6 +55,8 @@ template<typename NodeData> struct c_GraphNode {
 	uint32_t index;
 	NodeData nodeData;
 	std::vector<c_GraphNode<NodeData>*> cnt_out, cnt_in;
+	//! Position of this node within its owning c_Graph (set by the graph), or -1 if it is not owned by one.
+	uint32_t slot = (uint32_t)(-1);
 	
 	//! Constructs the node with just an ID and a value, associating it with no connections.
 	c_GraphNode(uint32_t id, const NodeData val) : index(id), nodeData(val) {}
@@ -130,12 +150,433 @@ struct c_GraphCnt {
 	uint8_t priority = 0;
 };
 
+/********!
+ * @class c_IdIndex
+ *
+ * @brief
+ * Maps node indexes (IDs) to slots in O(1) time. While the IDs stay compact (no larger than a small multiple of the
+ * number of entries), it is a direct-mapped table indexed by the ID. Once an ID would make the table too sparse, it
+ * switches to an open-addressing hash table with linear probing, where @c keys and @c table run parallel. Whenever the
+ * hash table has to grow, it returns to the direct-mapped mode if the IDs have since become compact again.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_IdIndex {
+	std::vector<uint32_t> table, keys;
+	uint32_t entries = 0, max_key = 0;
+	bool hashed = false;
+
+	//! Returns the slot associated with the ID, or -1 if it is not present.
+	uint32_t find(uint32_t ID) const noexcept {
+		return lookup(this->table.data(), this->keys.data(), this->table.size(), this->hashed, ID);
+	}
+	//! Finds the ID in the raw arrays of an index (as stored by @c table and @c keys), which lets a copy of them held
+	//! elsewhere, such as in a frozen graph or a mapped file, be searched without rebuilding the index.
+	static uint32_t lookup(const uint32_t* table, const uint32_t* keys, uint32_t size, bool hashed, uint32_t ID) noexcept {
+		if (!hashed) {
+			return (ID < size) ? table[ID] : (uint32_t)(-1);
+		}
+		const uint32_t mask = size - 1;
+		for (uint32_t i = hashOf(ID) & mask; table[i] != (uint32_t)(-1); i = (i + 1) & mask) {
+			if (keys[i] == ID) {
+				return table[i];
+			}
+		}
+		return -1;
+	}
+	//! Associates the ID with the specified slot, replacing any existing association.
+	void insert(uint32_t ID, uint32_t slot) {
+		if (ID > this->max_key) {
+			this->max_key = ID;
+		}
+		if (!this->hashed) {
+			if (ID >= this->table.size()) {
+				const uint64_t limit = denseLimit(this->entries + 1);
+				if (ID >= limit) {
+					this->rehash(this->entries + 1);
+					this->insertHashed(ID, slot);
+					return;
+				}
+				uint64_t grown = (uint64_t)(this->table.size()) * 2;
+				if (grown > limit) grown = limit;
+				if (grown <= ID) grown = (uint64_t)(ID) + 1;
+				this->table.resize(grown, -1);
+			}
+			if (this->table[ID] == (uint32_t)(-1)) {
+				this->entries++;
+			}
+			this->table[ID] = slot;
+			return;
+		}
+		if (((uint64_t)(this->entries) + 1) * 2 > this->table.size()) {
+			if (this->max_key < denseLimit(this->entries + 1)) {
+				this->densify();
+				this->insert(ID, slot);
+				return;
+			}
+			this->rehash(this->entries + 1);
+		}
+		this->insertHashed(ID, slot);
+	}
+	//! Removes the ID from the index. Returns TRUE if it was present.
+	bool erase(uint32_t ID) noexcept {
+		if (!this->hashed) {
+			if ((ID >= this->table.size()) || (this->table[ID] == (uint32_t)(-1))) {
+				return false;
+			}
+			this->table[ID] = -1;
+			this->entries--;
+			return true;
+		}
+		const uint32_t mask = this->table.size() - 1;
+		uint32_t i = hashOf(ID) & mask;
+		while (this->keys[i] != ID || this->table[i] == (uint32_t)(-1)) {
+			if (this->table[i] == (uint32_t)(-1)) {
+				return false;
+			}
+			i = (i + 1) & mask;
+		}
+		// Backward-shift deletion, so that no tombstones are needed for the probe sequences.
+		for (uint32_t j = (i + 1) & mask; this->table[j] != (uint32_t)(-1); j = (j + 1) & mask) {
+			const uint32_t home = hashOf(this->keys[j]) & mask;
+			if (((j - home) & mask) >= ((j - i) & mask)) {
+				this->keys[i] = this->keys[j];
+				this->table[i] = this->table[j];
+				i = j;
+			}
+		}
+		this->table[i] = -1;
+		this->entries--;
+		return true;
+	}
+	//! Removes every entry, returning the index to its direct-mapped mode.
+	void clear() noexcept {
+		this->table.clear();
+		this->keys.clear();
+		this->entries = 0;
+		this->max_key = 0;
+		this->hashed = false;
+	}
+	//! Returns the number of IDs stored.
+	uint32_t size() const noexcept {
+		return this->entries;
+	}
+private:
+	static uint32_t hashOf(uint32_t ID) noexcept {
+		return (uint32_t)(((uint64_t)(ID) * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+	// Largest direct-mapped table size that is considered compact enough for that many entries.
+	static uint64_t denseLimit(uint32_t entries) noexcept {
+		return ((uint64_t)(entries) * 4) + 64;
+	}
+	// Moves the hashed entries back into a direct-mapped table covering every key.
+	void densify() {
+		std::vector<uint32_t> oldTable, oldKeys;
+		oldTable.swap(this->table);
+		oldKeys.swap(this->keys);
+		this->table.assign((uint64_t)(this->max_key) + 1, -1);
+		this->hashed = false;
+		for (uint32_t i=0; i < oldTable.size(); i++) {
+			if (oldTable[i] != (uint32_t)(-1)) {
+				this->table[oldKeys[i]] = oldTable[i];
+			}
+		}
+	}
+	void insertHashed(uint32_t ID, uint32_t slot) {
+		const uint32_t mask = this->table.size() - 1;
+		uint32_t i = hashOf(ID) & mask;
+		for (; this->table[i] != (uint32_t)(-1); i = (i + 1) & mask) {
+			if (this->keys[i] == ID) {
+				this->table[i] = slot;
+				return;
+			}
+		}
+		this->keys[i] = ID;
+		this->table[i] = slot;
+		this->entries++;
+	}
+	// Switches to (or regrows) the hashed mode with room for at least 'needed' entries at a load factor of one half.
+	void rehash(uint32_t needed) {
+		uint64_t capacity = 16;
+		while (capacity < (uint64_t)(needed) * 2) capacity <<= 1;
+		std::vector<uint32_t> oldTable, oldKeys;
+		oldTable.swap(this->table);
+		oldKeys.swap(this->keys);
+		const bool wasHashed = this->hashed;
+		this->table.assign(capacity, -1);
+		this->keys.assign(capacity, 0);
+		this->entries = 0;
+		this->hashed = true;
+		for (uint32_t i=0; i < oldTable.size(); i++) {
+			if (oldTable[i] != (uint32_t)(-1)) {
+				this->insertHashed(wasHashed ? oldKeys[i] : i, oldTable[i]);
+			}
+		}
+	}
+};
+
+/********!
+ * @class c_EdgeIndex
+ *
+ * @brief
+ * Hash multimap from a connection (its origin and target indexes, packed into one 64-bit key) to its position in a
+ * connections vector, using linear probing at a load factor of at most one half. The same connection may be stored more
+ * than once, at different positions, to account for duplicate connections.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_EdgeIndex {
+	std::vector<uint64_t> keys;
+	std::vector<uint32_t> positions;
+	uint32_t entries = 0;
+
+	//! Packs the origin and target indexes (IDs) of a connection into its key.
+	static uint64_t keyOf(uint32_t from, uint32_t to) noexcept {
+		return ((uint64_t)(from) << 32) | to;
+	}
+	//! Returns the position of one of the entries for the key, or -1 if it is not present.
+	uint32_t find(uint64_t key) const noexcept {
+		if (this->positions.empty()) {
+			return -1;
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		for (uint32_t i = hashOf(key) & mask; this->positions[i] != (uint32_t)(-1); i = (i + 1) & mask) {
+			if (this->keys[i] == key) {
+				return this->positions[i];
+			}
+		}
+		return -1;
+	}
+	//! Adds an entry for the key at the specified position.
+	void insert(uint64_t key, uint32_t position) {
+		if (((uint64_t)(this->entries) + 1) * 2 > this->positions.size()) {
+			this->reserve(this->entries + 1);
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		uint32_t i = hashOf(key) & mask;
+		while (this->positions[i] != (uint32_t)(-1)) {
+			i = (i + 1) & mask;
+		}
+		this->keys[i] = key;
+		this->positions[i] = position;
+		this->entries++;
+	}
+	//! Changes the position of the entry for the key at @c from to @c to. Returns TRUE if that entry was present.
+	bool move(uint64_t key, uint32_t from, uint32_t to) noexcept {
+		const uint32_t i = this->locate(key, from);
+		if (i == (uint32_t)(-1)) {
+			return false;
+		}
+		this->positions[i] = to;
+		return true;
+	}
+	//! Removes the entry for the key at the specified position. Returns TRUE if it was present.
+	bool erase(uint64_t key, uint32_t position) noexcept {
+		uint32_t i = this->locate(key, position);
+		if (i == (uint32_t)(-1)) {
+			return false;
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		// Backward-shift deletion, as with c_IdIndex.
+		for (uint32_t j = (i + 1) & mask; this->positions[j] != (uint32_t)(-1); j = (j + 1) & mask) {
+			const uint32_t home = hashOf(this->keys[j]) & mask;
+			if (((j - home) & mask) >= ((j - i) & mask)) {
+				this->keys[i] = this->keys[j];
+				this->positions[i] = this->positions[j];
+				i = j;
+			}
+		}
+		this->positions[i] = -1;
+		this->entries--;
+		return true;
+	}
+	//! Grows the table to hold at least the specified number of entries without rehashing.
+	void reserve(uint32_t needed) {
+		uint64_t capacity = 16;
+		while (capacity < (uint64_t)(needed) * 2) capacity <<= 1;
+		if (capacity <= this->positions.size()) {
+			return;
+		}
+		std::vector<uint64_t> oldKeys;
+		std::vector<uint32_t> oldPositions;
+		oldKeys.swap(this->keys);
+		oldPositions.swap(this->positions);
+		this->keys.assign(capacity, 0);
+		this->positions.assign(capacity, -1);
+		this->entries = 0;
+		for (uint32_t i=0; i < oldPositions.size(); i++) {
+			if (oldPositions[i] != (uint32_t)(-1)) {
+				this->insert(oldKeys[i], oldPositions[i]);
+			}
+		}
+	}
+	//! Removes every entry.
+	void clear() noexcept {
+		this->keys.clear();
+		this->positions.clear();
+		this->entries = 0;
+	}
+	//! Returns the number of entries stored.
+	uint32_t size() const noexcept {
+		return this->entries;
+	}
+private:
+	static uint32_t hashOf(uint64_t key) noexcept {
+		return (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 32);
+	}
+	// Returns the table position of the entry with this key and position, or -1.
+	uint32_t locate(uint64_t key, uint32_t position) const noexcept {
+		if (this->positions.empty()) {
+			return -1;
+		}
+		const uint32_t mask = this->positions.size() - 1;
+		for (uint32_t i = hashOf(key) & mask; this->positions[i] != (uint32_t)(-1); i = (i + 1) & mask) {
+			if ((this->keys[i] == key) && (this->positions[i] == position)) {
+				return i;
+			}
+		}
+		return -1;
+	}
+};
+
+/********!
+ * @class c_VisitStamps
+ *
+ * @brief
+ * Visited set over dense slots, where each slot holds the epoch (query number) in which it was last visited. Starting
+ * a new query only advances the epoch, so a long-lived owner can reuse the same array for every query without clearing
+ * it or allocating; the array is only wiped on the (rare) epoch wrap-around.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_VisitStamps {
+	std::vector<uint32_t> stamps;
+	uint32_t epoch = 0;
+
+	//! Starts a new query over at least the specified number of slots, growing the array if needed.
+	void begin(uint32_t slots) {
+		if (this->stamps.size() < slots) {
+			this->stamps.resize(slots, 0);
+		}
+		this->epoch++;
+		if (this->epoch == 0) {
+			for (uint32_t& i : this->stamps) i = 0;
+			this->epoch = 1;
+		}
+	}
+	//! Returns TRUE if the slot has not been visited during this query, and then marks it. Returns FALSE otherwise.
+	bool testAdd(uint32_t slot) noexcept {
+		if (this->stamps[slot] == this->epoch) {
+			return false;
+		}
+		this->stamps[slot] = this->epoch;
+		return true;
+	}
+	//! Returns TRUE if the slot has been visited during this query.
+	bool test(uint32_t slot) const noexcept {
+		return this->stamps[slot] == this->epoch;
+	}
+	//! Returns the number of slots currently covered.
+	uint32_t size() const noexcept {
+		return this->stamps.size();
+	}
+};
+
+//! Emission order for the Depth-First traversals.
+enum class e_DfsOrder : uint8_t {
+	PreOrder,	//!< Nodes are emitted when they are first reached (the standard order).
+	PostOrder	//!< Nodes are emitted once all of their connections have been finished (finish-time order).
+};
+
+//! One entry of the explicit Depth-First stack: the node, the next connection of it to follow, and whether it is output.
+template<typename NodeData> struct c_DfsFrame {
+	c_GraphNode<NodeData>* node;
+	uint32_t cursor;
+	bool accepted;
+};
+
+#ifdef ERC_GRAPH_STATS
+//! Statistics recorded for one traversal by the search header that ran it, and published by the c_Graph run* methods.
+struct c_TraversalStats {
+	uint64_t nodes_visited = 0;			//!< Nodes reached for the first time (including the initial node).
+	uint64_t edges_scanned = 0;			//!< Outbound connections examined.
+	uint64_t visited_tests = 0;			//!< Nodes checked against the visited set.
+	uint64_t elapsed_ns = 0;			//!< Wall time of the run* call, in nanoseconds.
+	std::vector<uint32_t> frontier_sizes;	//!< Breadth-First only: the number of nodes expanded at each level.
+	
+	//! Clears the statistics for a new traversal, keeping the capacity of @c frontier_sizes.
+	void reset() noexcept {
+		this->nodes_visited = 0;
+		this->edges_scanned = 0;
+		this->visited_tests = 0;
+		this->elapsed_ns = 0;
+		this->frontier_sizes.clear();
+	}
+	//! Returns the number of visited-set tests that found the node already visited.
+	uint64_t visitedHits() const noexcept {
+		return this->visited_tests - this->nodes_visited;
+	}
+	//! Returns the fraction of visited-set tests that found the node already visited, or 0 if there were none.
+	double hitRate() const noexcept {
+		return (this->visited_tests != 0) ? double(this->visitedHits()) / double(this->visited_tests) : 0.0;
+	}
+};
+
+//! Original function of the c_Graph statistics observer (see c_Graph::statsObserver), which does nothing.
+inline void devDiscardStats(const c_TraversalStats&) noexcept {}
+#endif
+
 //! Helper structure for running the graph-level traversal, so we don't have to make four shared pointer parameters.
+//! A header handed to the traversals by the caller may be long-lived: after beginDense() it marks nodes by slot through
+//! a c_VisitStamps set, which makes every visited test O(1) and lets the header be reused without any allocation.
 template<typename NodeData> struct c_SearchHeader {
 	// I'm aware this would be more efficient as a <queue> structure (for BFS), but I wanted to make this code with as few headers as possible, and to support DFS.
-	std::vector<c_GraphNode<NodeData>*> visit_queue;
+	std::vector<c_GraphNode<NodeData>*> visit_queue, next_queue;
+	std::vector<c_DfsFrame<NodeData>> dfs_stack;
 	std::vector<uint32_t> idx_visited;
 	uint32_t min_idx = 4294967293, max_idx = 0;
+	c_VisitStamps visited;
+	bool dense = false;
+#ifdef ERC_GRAPH_STATS
+	c_TraversalStats stats; // Reset by beginDense(), and added to by the traversal cores.
+#endif
+	
+	//! Prepares the header for a new traversal over a graph of the specified number of slots, using the dense visited set.
+	void beginDense(uint32_t slots) {
+		this->visited.begin(slots);
+		this->dense = true;
+		this->visit_queue.clear();
+#ifdef ERC_GRAPH_STATS
+		this->stats.reset();
+#endif
+	}
+	//! Returns TRUE if the node has not been visited, and then marks it. Uses the node's slot when the header is dense (and
+	//! the node belongs to a graph), and its index otherwise.
+	bool testAdd(const c_GraphNode<NodeData>* node) {
+		const bool added = (this->dense && (node->slot < this->visited.size())) ? this->visited.testAdd(node->slot) : this->testAdd(node->index);
+#ifdef ERC_GRAPH_STATS
+		this->stats.visited_tests++;
+		this->stats.nodes_visited += added;
+#endif
+		return added;
+	}
+	//! Counts one outbound connection examined by a traversal. Does nothing unless ERC_GRAPH_STATS is defined.
+	void countEdge() noexcept {
+#ifdef ERC_GRAPH_STATS
+		this->stats.edges_scanned++;
+#endif
+	}
+	//! Records the size of a Breadth-First frontier as it is expanded. Does nothing unless ERC_GRAPH_STATS is defined.
+	void countLevel(uint32_t frontier) {
+#ifdef ERC_GRAPH_STATS
+		this->stats.frontier_sizes.push_back(frontier);
+#else
+		(void)frontier;
+#endif
+	}
 	//! Returns TRUE if the index has not been visited, and then adds the index to the list. Returns FALSE if the index has been visited.
 	bool testAdd(uint32_t index) {
 		if (index > max_idx) {
@@ -163,334 +604,1945 @@ template<typename NodeData> struct c_SearchHeader {
 	}
 };
 
-//! Helper function for running a Breadth-First traversal from the specified node. Runs recursively!
-template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseBfs(c_GraphNode<NodeData>* start, c_SearchHeader<NodeData> *recurseHeader = nullptr) {
-	if (start == nullptr) {
-		return {};
-	}
-	std::vector<c_GraphNode<NodeData>*> output_list = {};
-	
-	bool owns_header = false;
-	c_SearchHeader<NodeData> * header = recurseHeader;
-	if (header == nullptr) {
-		dbgprint("Header is being created.");
-		header = new c_SearchHeader<NodeData>;
-		owns_header = true;
-	}
-	
-	uint32_t degrees = start->externalDegree();
-	
-	char iter = '?';
-	if (start->index <= 9) {
-		iter = ('0' + start->index);
+//! Filter that accepts every node, which lets the unfiltered traversals share the filtered implementations.
+template<typename NodeData> struct c_AcceptAll {
+	bool operator()(c_GraphNode<NodeData>*, c_GraphNode<NodeData>*) const noexcept {
+		return true;
 	}
-	if (header->testAdd(start->index)) {
-		output_list.push_back(start);
-		if (start->index <= 9) {
-			char debugprnt[] = "BFS level  ";
-			debugprnt[10] = iter;
-			dbgprint(debugprnt);
-		}
+};
+
+/********!
+ * @date	14 October 2026
+ * @brief
+ *  	Core of the Breadth-First traversals. Runs iteratively, level by level: the current frontier is held in the header's
+ *  	@c visit_queue, the next one is collected in @c next_queue, and the two are swapped at the end of each level. The
+ *  	output is appended in the usual breadth-first order (each frontier node's new connections, in order).
+ * @param [in] start
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] searchFunc
+ *  	Filter deciding which discovered nodes are appended to the output; it is passed the discovering node (nullptr for
+ *  	@c start) and the discovered node. Every discovered node is expanded, whether or not it passes the filter.
+ * @param [in] header
+ *  	The search header to track visited nodes with. Must not be null.
+ * @param [out] output
+ *  	The vector that the accepted nodes are appended to.
+ * @param [out] levels
+ *  	If non-null, receives the level (distance from @c start) of each accepted node, parallel to @c output.
+ ********/
+template<typename NodeData, typename Filter> void devRunBfs(c_GraphNode<NodeData>* start, Filter& searchFunc, c_SearchHeader<NodeData>* header, std::vector<c_GraphNode<NodeData>*>& output, std::vector<uint32_t>* levels) {
+	std::vector<c_GraphNode<NodeData>*>& frontier = header->visit_queue, & upcoming = header->next_queue;
+	frontier.clear();
+	upcoming.clear();
+	if (header->testAdd(start) && searchFunc(nullptr, start)) {
+		output.push_back(start);
+		if (levels != nullptr) levels->push_back(0);
 	}
-	
-	for (uint32_t i=0; i < degrees; i++) {
-		c_GraphNode<NodeData>* node = start->cnt_out.at(i);
-		// Load each node that isn't already registered.
-		if (node != nullptr && header->testAdd(node->index)) {
-			if (i < 10) {
-				char printable[] = " Added degr   from index  ";
-				printable[12] = '0' + i;
-				printable[25] = iter;
-				dbgprint(printable);
-			}
-			output_list.push_back(node);
-			header->visit_queue.push_back(node); // this was the culprit of 20 mins of debugging. forgot to add the node to the queue.
-		}
-	}
-	std::vector<c_GraphNode<NodeData>*> dequeue, newqueue;
-	// Dequeue all pending jobs.
-	do {
-		// Go through all dequeues until one returns new data (skip redundant calls)
-		while (dequeue.empty() && !header->visit_queue.empty()) {
-			c_GraphNode<NodeData>* handle = header->visit_queue.at(0);
-			header->visit_queue.erase(header->visit_queue.begin()); // erase that entry BEFORE we call this to prevent recursion
-			dequeue = devTraverseBfs(handle, header);
-		}
-		for (c_GraphNode<NodeData>* i : dequeue) {
-			if (i != nullptr) { //this is mostly a sanity check, but still important
-				newqueue.push_back(i);
-				output_list.push_back(i);
-			}
-		}
-		dequeue.clear();
-		// Exclusively for the "owner" level, keep dequeueing until physically empty.
-		// Recursive ones will break once the visit_queue empties
-		if (owns_header && header->visit_queue.empty() && !newqueue.empty()) {
-			header->visit_queue = newqueue;
-			if (newqueue.size() < 10) {
-				char tmpextra[] = "Adding new queue of size  ";
-				tmpextra[25] = '0' + newqueue.size();
-				dbgprint(tmpextra);
-			} else {
-				dbgprint("Adding big queue.");
+	frontier.push_back(start);
+	for (uint32_t level = 1; !frontier.empty(); level++) {
+		header->countLevel(frontier.size());
+		for (c_GraphNode<NodeData>* current : frontier) {
+			for (c_GraphNode<NodeData>* node : current->cnt_out) {
+				header->countEdge();
+				// Load each node that isn't already registered.
+				if (node != nullptr && header->testAdd(node)) {
+					if (searchFunc(current, node)) {
+						output.push_back(node);
+						if (levels != nullptr) levels->push_back(level);
+					}
+					upcoming.push_back(node);
+				}
 			}
-			newqueue = {};
 		}
-	} while (!header->visit_queue.empty());
-	if (owns_header) {
-		delete header;
-		return output_list;
-	} else {
-		// Assign the next level's queue (the collected nodes from dequeueing this level)
-		if (!newqueue.empty()) {
-			dbgprint("Leaving a level.");
-			header->visit_queue = newqueue;
-		}
-		return output_list;
+		frontier.swap(upcoming);
+		upcoming.clear();
+	}
+}
+
+//! Helper function for running a Breadth-First traversal from the specified node. Runs iteratively, one level at a time.
+//! If @c levels is non-null, it receives the level (distance from @c start) of each node, parallel to the output vector.
+template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseBfs(c_GraphNode<NodeData>* start, c_SearchHeader<NodeData> *header = nullptr, std::vector<uint32_t>* levels = nullptr) {
+	if (start == nullptr) {
+		return {};
 	}
+	std::vector<c_GraphNode<NodeData>*> output_list = {};
+	c_SearchHeader<NodeData> local;
+	c_AcceptAll<NodeData> all;
+	devRunBfs(start, all, (header != nullptr) ? header : &local, output_list, levels);
+	return output_list;
 }
 
 
-//! Helper function for running a Breadth-First "Filtered" traversal, from the specified node. Runs recursively!
-//! The function must return TRUE to add it to the output vector, and must take two parameters: the last-level node as the first parameter,  and the currently-tested node as the second.
+//! Helper function for running a Breadth-First "Filtered" traversal, from the specified node. Runs iteratively, one level at a time.
+//! The function (any callable, such as a capturing lambda) must return TRUE to add it to the output vector, and must take two parameters: the last-level node as the first parameter,  and the currently-tested node as the second.
 //! The search function must be prepared to handle null pointers, almost exclusively for the first node alone ("last-level" will be nullptr).
-template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseBfs_Filt(c_GraphNode<NodeData>* start, bool (* searchFunc)(c_GraphNode<NodeData>*, c_GraphNode<NodeData>*), c_SearchHeader<NodeData> *recurseHeader = nullptr) {
+//! If @c levels is non-null, it receives the level (distance from @c start) of each output node, parallel to the output vector.
+template<typename NodeData, typename Filter> std::vector<c_GraphNode<NodeData>*> devTraverseBfs_Filt(c_GraphNode<NodeData>* start, Filter searchFunc, c_SearchHeader<NodeData> *header = nullptr, std::vector<uint32_t>* levels = nullptr) {
 	if (start == nullptr) {
 		return {};
 	}
 	std::vector<c_GraphNode<NodeData>*> output_list = {};
-	
-	bool owns_header = false;
-	c_SearchHeader<NodeData> * header = recurseHeader;
-	if (header == nullptr) {
-		dbgprint("Header is being created.");
-		header = new c_SearchHeader<NodeData>;
-		owns_header = true;
-	}
-	
-	uint32_t degrees = start->externalDegree();
-	
-	char iter = '?';
-	if (start->index <= 9) {
-		iter = ('0' + start->index);
-	}
-	if (header->testAdd(start->index)) {
-		if (owns_header) {
-			if (searchFunc(nullptr, start))
-				output_list.push_back(start);
-		}
-		if (start->index <= 9) {
-			char debugprnt[] = "BFS level  ";
-			debugprnt[10] = iter;
-			dbgprint(debugprnt);
-		}
+	c_SearchHeader<NodeData> local;
+	devRunBfs(start, searchFunc, (header != nullptr) ? header : &local, output_list, levels);
+	return output_list;
+}
+
+/********!
+ * @date	14 October 2026
+ * @brief
+ *  	Core of the Depth-First traversals. Runs iteratively on the header's explicit @c dfs_stack, so long chains do not
+ *  	consume the call stack, and appends straight into the caller's output vector. Nodes are marked as visited when they
+ *  	are first reached (as with the recursive implementation), and are emitted either at that point or once all of their
+ *  	connections have been finished.
+ * @param [in] start
+ *  	Node to begin the traversal from. Must not be null.
+ * @param [in] searchFunc
+ *  	Filter deciding which reached nodes are appended to the output; it is passed the node that reached it (nullptr for
+ *  	@c start) and the reached node. Every reached node is traversed, whether or not it passes the filter.
+ * @param [in] header
+ *  	The search header to track visited nodes with. Must not be null.
+ * @param [out] output
+ *  	The vector that the accepted nodes are appended to.
+ * @param [in] order
+ *  	Whether nodes are emitted in pre-order (when reached) or post-order (when finished).
+ ********/
+template<typename NodeData, typename Filter> void devRunDfs(c_GraphNode<NodeData>* start, Filter& searchFunc, c_SearchHeader<NodeData>* header, std::vector<c_GraphNode<NodeData>*>& output, e_DfsOrder order) {
+	std::vector<c_DfsFrame<NodeData>>& stack = header->dfs_stack;
+	const bool post = (order == e_DfsOrder::PostOrder);
+	stack.clear();
+	// We add this node before traversing as far as possible
+	bool accepted = header->testAdd(start) && searchFunc(nullptr, start);
+	if (accepted && !post) {
+		output.push_back(start);
 	}
-	
-	for (uint32_t i=0; i < degrees; i++) {
-		c_GraphNode<NodeData>* node = start->cnt_out.at(i);
-		// Load each node that isn't already registered.
-		if (node != nullptr && header->testAdd(node->index)) {
-			if (i < 10) {
-				char printable[] = " Added degr   from index  ";
-				printable[12] = '0' + i;
-				printable[25] = iter;
-				dbgprint(printable);
-			}
-			if (searchFunc(start, node)) {
-				output_list.push_back(node);
-			}
-			header->visit_queue.push_back(node); // this was the culprit of 20 mins of debugging. forgot to add the node to the queue.
-		}
-	}
-	std::vector<c_GraphNode<NodeData>*> dequeue, newqueue;
-	// Dequeue all pending jobs.
-	do {
-		// Go through all dequeues until one returns new data (skip redundant calls)
-		while (dequeue.empty() && !header->visit_queue.empty()) {
-			c_GraphNode<NodeData>* handle = header->visit_queue.at(0);
-			header->visit_queue.erase(header->visit_queue.begin()); // erase that entry BEFORE we call this to prevent recursion
-			dequeue = devTraverseBfs_Filt(handle, searchFunc, header);
-		}
-		for (c_GraphNode<NodeData>* i : dequeue) {
-			if (i != nullptr) { //this is mostly a sanity check, but still important
-				newqueue.push_back(i);
-				// We've already tested anything that gets returned.
-				output_list.push_back(i);
-			}
-		}
-		dequeue.clear();
-		// Exclusively for the "owner" level, keep dequeueing until physically empty.
-		// Recursive ones will break once the visit_queue empties
-		if (owns_header && header->visit_queue.empty() && !newqueue.empty()) {
-			header->visit_queue = newqueue;
-			if (newqueue.size() < 10) {
-				char tmpextra[] = "Adding new queue of size  ";
-				tmpextra[25] = '0' + newqueue.size();
-				dbgprint(tmpextra);
-			} else {
-				dbgprint("Adding big queue.");
+	stack.push_back({start, 0, accepted});
+	while (!stack.empty()) {
+		c_DfsFrame<NodeData>& frame = stack.back();
+		c_GraphNode<NodeData>* current = frame.node;
+		if (frame.cursor == current->cnt_out.size()) {
+			if (post && frame.accepted) {
+				output.push_back(current);
 			}
-			newqueue = {};
+			stack.pop_back();
+			continue;
 		}
-	} while (!header->visit_queue.empty());
-	if (owns_header) {
-		delete header;
-		return output_list;
-	} else {
-		// Assign the next level's queue (the collected nodes from dequeueing this level)
-		if (!newqueue.empty()) {
-			dbgprint("Leaving a level.");
-			header->visit_queue = newqueue;
+		c_GraphNode<NodeData>* node = current->cnt_out[frame.cursor];
+		frame.cursor++;
+		header->countEdge();
+		if (node != nullptr && header->testAdd(node)) {
+			accepted = searchFunc(current, node);
+			if (accepted && !post) {
+				output.push_back(node);
+			}
+			stack.push_back({node, 0, accepted}); // 'frame' is invalidated from here on.
 		}
-		return output_list;
 	}
 }
 
+//! Runs a Depth-First traversal from the specified node, appending the nodes to @c output in the specified order.
+template<typename NodeData> void devTraverseDfs(c_GraphNode<NodeData>* start, std::vector<c_GraphNode<NodeData>*>& output, e_DfsOrder order = e_DfsOrder::PreOrder, c_SearchHeader<NodeData>* header = nullptr) {
+	if (start == nullptr) {
+		return;
+	}
+	c_SearchHeader<NodeData> local;
+	c_AcceptAll<NodeData> all;
+	devRunDfs(start, all, (header != nullptr) ? header : &local, output, order);
+}
+
 //! Runs a Depth-First traversal from the specified node.
-template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseDfs(c_GraphNode<NodeData>* start, c_SearchHeader<NodeData>* recurseHeader = nullptr) {
+template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseDfs(c_GraphNode<NodeData>* start, c_SearchHeader<NodeData>* header = nullptr) {
+	std::vector<c_GraphNode<NodeData>*> output_list = {};
+	devTraverseDfs(start, output_list, e_DfsOrder::PreOrder, header);
+	return output_list;
+}
+
+//! Runs a Depth-First filtered traversal from the specified node, appending the accepted nodes to @c output in the specified order.
+//! The function (any callable, such as a capturing lambda) must return TRUE to add it to the output vector, and must take two parameters: the last-level node as the first parameter,  and the currently-tested node as the second.
+//! The search function must be prepared to handle null pointers, almost exclusively for the first node alone ("last-level" will be nullptr).
+template<typename NodeData, typename Filter> void devTraverseDfs_Filt(c_GraphNode<NodeData>* start, Filter searchFunc, std::vector<c_GraphNode<NodeData>*>& output, e_DfsOrder order = e_DfsOrder::PreOrder, c_SearchHeader<NodeData>* header = nullptr) {
 	if (start == nullptr) {
-		return {};
+		return;
 	}
+	c_SearchHeader<NodeData> local;
+	devRunDfs(start, searchFunc, (header != nullptr) ? header : &local, output, order);
+}
+
+//! Runs a Depth-First filtered traversal from the specified node.
+//! The function (any callable, such as a capturing lambda) must return TRUE to add it to the output vector, and must take two parameters: the last-level node as the first parameter,  and the currently-tested node as the second.
+//! The search function must be prepared to handle null pointers, almost exclusively for the first node alone ("last-level" will be nullptr).
+template<typename NodeData, typename Filter> std::vector<c_GraphNode<NodeData>*> devTraverseDfs_Filt(c_GraphNode<NodeData>* start, Filter searchFunc, c_SearchHeader<NodeData>* header = nullptr) {
 	std::vector<c_GraphNode<NodeData>*> output_list = {};
-	
-	bool owns_header = false;
-	c_SearchHeader<NodeData> * header = recurseHeader;
+	devTraverseDfs_Filt(start, searchFunc, output_list, e_DfsOrder::PreOrder, header);
+	return output_list;
+}
+
+//! What a traversal visitor wants to happen after it has been shown a node.
+enum class e_Visit : uint8_t {
+	Continue,	//!< Keep going, including through the connections of this node.
+	Prune,		//!< Keep going, but do not follow the connections of this node (they may still be reached some other way).
+	Stop		//!< End the traversal immediately.
+};
+
+/********!
+ * @date	14 October 2026
+ * @brief
+ *  	Runs a Breadth-First traversal from the specified node, in the same order as devTraverseBfs, but hands each node to
+ *  	a visitor as it is discovered instead of collecting an output vector. The visitor decides whether the node's
+ *  	connections are followed, and can end the traversal early.
+ * @param [in] start
+ *  	Node to begin the traversal from.
+ * @param [in] visitor
+ *  	Callable taking the discovering node (nullptr for @c start) and the discovered node, and returning an e_Visit.
+ * @param [in] header
+ *  	Optional search header to track visited nodes with. If null, a temporary one is allocated.
+ * @return
+ *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it (or @c start is null).
+ ********/
+template<typename NodeData, typename Visitor> bool devVisitBfs(c_GraphNode<NodeData>* start, Visitor visitor, c_SearchHeader<NodeData>* header = nullptr) {
+	if (start == nullptr) {
+		return false;
+	}
+	c_SearchHeader<NodeData> local;
 	if (header == nullptr) {
-		dbgprint("Header is being created.");
-		header = new c_SearchHeader<NodeData>;
-		owns_header = true;
+		header = &local;
 	}
-	
-	uint32_t degrees = start->externalDegree();
-
-	// We add this node before traversing as far as possible
-	if (header->testAdd(start->index)) {
-		output_list.push_back(start);
+	std::vector<c_GraphNode<NodeData>*>& frontier = header->visit_queue, & upcoming = header->next_queue;
+	frontier.clear();
+	upcoming.clear();
+	if (header->testAdd(start)) {
+		const e_Visit action = visitor(nullptr, start);
+		if (action == e_Visit::Stop) return false;
+		if (action == e_Visit::Continue) frontier.push_back(start);
 	}
-	std::vector<c_GraphNode<NodeData>*> dequeue;
-	for (uint32_t i=0; i < degrees; i++) {
-		c_GraphNode<NodeData>* node = start->cnt_out.at(i);
-		if (header->testAdd(node->index)) {
-			output_list.push_back(node);
-			dequeue = devTraverseDfs(node, header);
-			for (c_GraphNode<NodeData>* i : dequeue) {
-				output_list.push_back(i);
+	while (!frontier.empty()) {
+		header->countLevel(frontier.size());
+		for (c_GraphNode<NodeData>* current : frontier) {
+			for (c_GraphNode<NodeData>* node : current->cnt_out) {
+				header->countEdge();
+				if (node != nullptr && header->testAdd(node)) {
+					const e_Visit action = visitor(current, node);
+					if (action == e_Visit::Stop) return false;
+					if (action == e_Visit::Continue) upcoming.push_back(node);
+				}
 			}
 		}
+		frontier.swap(upcoming);
+		upcoming.clear();
 	}
-	if (owns_header) {
-		delete header;
-	}
-	return output_list;
+	return true;
 }
 
-
-//! Runs a Depth-First filtered traversal from the specified node.
-//! The function must return TRUE to add it to the output vector, and must take two parameters: the last-level node as the first parameter,  and the currently-tested node as the second.
-//! The search function must be prepared to handle null pointers, almost exclusively for the first node alone ("last-level" will be nullptr).
-template<typename NodeData> std::vector<c_GraphNode<NodeData>*> devTraverseDfs_Filt(c_GraphNode<NodeData>* start, bool (* searchFunc)(c_GraphNode<NodeData>*, c_GraphNode<NodeData>*), c_SearchHeader<NodeData>* recurseHeader = nullptr) {
+/********!
+ * @date	14 October 2026
+ * @brief
+ *  	Runs a Depth-First traversal from the specified node, in the same (pre-)order as devTraverseDfs, but hands each node
+ *  	to a visitor as it is reached instead of collecting an output vector. The visitor decides whether the traversal
+ *  	descends into the node's connections, and can end the traversal early.
+ * @param [in] start
+ *  	Node to begin the traversal from.
+ * @param [in] visitor
+ *  	Callable taking the node that reached it (nullptr for @c start) and the reached node, and returning an e_Visit.
+ * @param [in] header
+ *  	Optional search header to track visited nodes with. If null, a temporary one is allocated.
+ * @return
+ *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it (or @c start is null).
+ ********/
+template<typename NodeData, typename Visitor> bool devVisitDfs(c_GraphNode<NodeData>* start, Visitor visitor, c_SearchHeader<NodeData>* header = nullptr) {
 	if (start == nullptr) {
-		return {};
+		return false;
 	}
-	std::vector<c_GraphNode<NodeData>*> output_list = {};
-	
-	bool owns_header = false;
-	c_SearchHeader<NodeData> * header = recurseHeader;
+	c_SearchHeader<NodeData> local;
 	if (header == nullptr) {
-		dbgprint("Header is being created.");
-		header = new c_SearchHeader<NodeData>;
-		owns_header = true;
+		header = &local;
 	}
-	
-	uint32_t degrees = start->externalDegree();
-
-	// We add this node before traversing as far as possible
-	if (header->testAdd(start->index)) {
-		if (searchFunc(nullptr, start)) {
-			output_list.push_back(start);
+	std::vector<c_DfsFrame<NodeData>>& stack = header->dfs_stack;
+	stack.clear();
+	if (header->testAdd(start)) {
+		const e_Visit action = visitor(nullptr, start);
+		if (action == e_Visit::Stop) return false;
+		if (action == e_Visit::Continue) stack.push_back({start, 0, true});
+	}
+	while (!stack.empty()) {
+		c_DfsFrame<NodeData>& frame = stack.back();
+		c_GraphNode<NodeData>* current = frame.node;
+		if (frame.cursor == current->cnt_out.size()) {
+			stack.pop_back();
+			continue;
+		}
+		c_GraphNode<NodeData>* node = current->cnt_out[frame.cursor];
+		frame.cursor++;
+		header->countEdge();
+		if (node != nullptr && header->testAdd(node)) {
+			const e_Visit action = visitor(current, node);
+			if (action == e_Visit::Stop) return false;
+			if (action == e_Visit::Continue) stack.push_back({node, 0, true}); // 'frame' is invalidated from here on.
 		}
 	}
-	std::vector<c_GraphNode<NodeData>*> dequeue;
-	for (uint32_t i=0; i < degrees; i++) {
-		c_GraphNode<NodeData>* node = start->cnt_out.at(i);
-		if (header->testAdd(node->index)) {
-			if (searchFunc(start, node))
-				output_list.push_back(node);
-			dequeue = devTraverseDfs_Filt(node, searchFunc, header);
-			for (c_GraphNode<NodeData>* i : dequeue) {
-				output_list.push_back(i);
+	return true;
+}
+
+#ifdef ERC_GRAPH_PARALLEL
+//! Reusable barrier for a fixed number of threads, which spins (yielding its time slice) until all of them have arrived.
+struct c_SpinBarrier {
+	std::atomic<uint32_t> waiting, generation;
+	const uint32_t parties;
+	
+	c_SpinBarrier(uint32_t threads) : waiting(0), generation(0), parties(threads) {}
+	//! Blocks until every thread has called arrive() for the current generation.
+	void arrive() noexcept {
+		const uint32_t gen = this->generation.load(std::memory_order_acquire);
+		if (this->waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == this->parties) {
+			this->waiting.store(0, std::memory_order_relaxed);
+			this->generation.fetch_add(1, std::memory_order_acq_rel);
+		} else {
+			while (this->generation.load(std::memory_order_acquire) == gen) {
+				std::this_thread::yield();
 			}
 		}
 	}
-	if (owns_header) {
-		delete header;
+};
+
+// The thread helpers are shared with BinaryTree.hpp (see ParallelThreads.hpp).
+using ParallelThreads::devParallelThreads;
+using ParallelThreads::devRunThreads;
+#endif
+
+//! Reusable scratch state for the visitor traversals over a frozen graph (see c_GraphCSR::visitBfs): the visited set, and
+//! the queue or stack of slots with the connection cursor of each.
+struct c_SlotSearch {
+	c_VisitStamps visited;
+	std::vector<uint32_t> queue, cursor;
+};
+
+//! Priority queue used by the shortest-path searches.
+enum class e_PathQueue : uint8_t {
+	BinaryHeap,	//!< Dijkstra's algorithm on a binary min-heap, in O((V + E) log V) time.
+	Buckets		//!< Dial's algorithm on a circular queue of 256 buckets (one per distance modulo 256), in O(V + E + D) time for a longest distance D.
+};
+
+//! Heuristic for the shortest-path searches that estimates nothing, which reduces A* to Dijkstra's algorithm.
+struct c_NoHeuristic {
+	uint64_t operator()(uint32_t) const noexcept {
+		return 0;
 	}
-	return output_list;
-}
+};
 
 /********!
- * @class c_GraphNode
- * 
+ * @class c_PathSearch
+ *
  * @brief
- * Represents a combined graph structure, with multiple means of construction and with some utility handlers. Supports the
- * storage and optimization of up to 4,294,967,290 unique nodes.
- * 
+ * Reusable state for the shortest-path searches over a frozen graph (see c_GraphCSR::shortestPath), holding the tentative
+ * distances and parents of each slot as well as the priority queues. Like c_VisitStamps, starting a new query does not
+ * clear or reallocate anything once the arrays have grown to the size of the graph, so a long-lived searcher can serve a
+ * high rate of queries. Once a query is done, the distance and path to every settled slot can be read back from it.
+ *
  * @date
- * 30 October 2024
+ * 14 October 2026
  ********/
-template<typename NodeData> class c_Graph {
-	std::vector<c_GraphNode<NodeData>*> raw_ptrs;
-	std::vector<c_GraphCnt> calc_cnts;
-	std::vector<uint32_t> degrees, indexes; // BOTH of these vectors are aligned with the order of raw_ptrs, not the node indexes!
-	uint32_t count = 0;
-	// Allows ID mapping, assuming that 'indexes' and 'raw_ptrs' are in the same order (true when constructed).
-	// Returns -1 (4294967293 for uint32_t) if the ID provided is not in the vector.
-	uint32_t idxMap(uint32_t ID) {
-		for (uint32_t i=0; i < indexes.size(); i++) {
-			if (indexes.at(i) == ID) {
-				return i;
-			}
+struct c_PathSearch {
+	//! Distance reported for slots that were not settled by the last query.
+	static constexpr uint64_t unreached = (uint64_t)(-1);
+	//! One entry of the binary heap: the key (distance, plus the heuristic for A*) and the slot it was pushed for.
+	struct c_Entry {
+		uint64_t key;
+		uint32_t slot;
+	};
+	std::vector<uint64_t> dist;
+	std::vector<uint32_t> parent;
+	c_VisitStamps reached, settled;
+	std::vector<c_Entry> heap;
+	std::vector<uint32_t> buckets[256];
+	uint32_t source = -1;
+
+	//! Starts a new query from the specified slot, over at least the specified number of slots.
+	void begin(uint32_t slots, uint32_t start) {
+		if (this->dist.size() < slots) {
+			this->dist.resize(slots);
+			this->parent.resize(slots);
 		}
-		return -1;
+		this->reached.begin(slots);
+		this->settled.begin(slots);
+		this->heap.clear();
+		for (std::vector<uint32_t>& i : this->buckets) {
+			i.clear();
+		}
+		this->source = start;
+		this->reached.testAdd(start);
+		this->dist[start] = 0;
+		this->parent[start] = start;
 	}
-public:
-	//! Initialize an empty graph structure.
-	c_Graph() {}
-	//! Initialize a pre-filled graph structure, where all nodes share the same value. All connections added must be specified.
-	//! Connections will be processed and nodes will be created as needed for the indexes present.
-	//! Report connections, at least for the initializer list, as {ID_from, ID_to, priority} or just {ID_from, ID_to}.
-	c_Graph(const NodeData prefill, std::initializer_list<c_GraphCnt> connectionList) {
-		for (c_GraphCnt TMP : connectionList) {
-			uint32_t i = idxMap(TMP.from);
-			if ((i == 4294967293) || (i == (uint32_t)(-1))) {
-				indexes.push_back(TMP.from);
-				raw_ptrs.push_back(new c_GraphNode<NodeData>(TMP.from, prefill));
-				i = indexes.size() - 1;
+	//! Lowers the tentative distance of a slot if the new one is shorter. Returns TRUE if it was lowered.
+	bool relax(uint32_t slot, uint64_t distance, uint32_t from) noexcept {
+		if (this->reached.testAdd(slot) || (distance < this->dist[slot])) {
+			this->dist[slot] = distance;
+			this->parent[slot] = from;
+			return true;
+		}
+		return false;
+	}
+	//! Adds an entry to the binary heap.
+	void push(uint64_t key, uint32_t slot) {
+		uint32_t i = this->heap.size();
+		this->heap.push_back({key, slot});
+		while (i != 0) {
+			const uint32_t up = (i - 1) / 2;
+			if (this->heap[up].key <= key) break;
+			this->heap[i] = this->heap[up];
+			i = up;
+		}
+		this->heap[i] = {key, slot};
+	}
+	//! Removes and returns the entry with the smallest key from the (non-empty) binary heap.
+	c_Entry pop() noexcept {
+		const c_Entry top = this->heap.front(), last = this->heap.back();
+		this->heap.pop_back();
+		const uint32_t size = this->heap.size();
+		if (size != 0) {
+			uint32_t i = 0;
+			for (uint32_t child; (child = 2 * i + 1) < size; i = child) {
+				if ((child + 1 < size) && (this->heap[child + 1].key < this->heap[child].key)) child++;
+				if (last.key <= this->heap[child].key) break;
+				this->heap[i] = this->heap[child];
 			}
-			uint32_t j = idxMap(TMP.to);
+			this->heap[i] = last;
+		}
+		return top;
+	}
+	//! Returns the shortest distance to the slot found by the last query, or @c unreached if it was not settled.
+	uint64_t distance(uint32_t slot) const noexcept {
+		if ((slot >= this->settled.size()) || !this->settled.test(slot)) {
+			return unreached;
+		}
+		return this->dist[slot];
+	}
+	//! Appends the slots along the shortest path found by the last query, from its source to the specified (settled) slot,
+	//! to @c output. Returns the number of slots appended, which is zero if the slot was not settled.
+	uint32_t pathTo(uint32_t slot, std::vector<uint32_t>& output) const {
+		if (this->distance(slot) == unreached) {
+			return 0;
+		}
+		const uint32_t before = output.size();
+		for (uint32_t i = slot; ; i = this->parent[i]) {
+			output.push_back(i);
+			if (i == this->source) break;
+		}
+		// The walk goes from the end to the source, so flip it in place.
+		for (uint32_t lo = before, hi = output.size() - 1; lo < hi; lo++, hi--) {
+			const uint32_t tmp = output[lo];
+			output[lo] = output[hi];
+			output[hi] = tmp;
+		}
+		return output.size() - before;
+	}
+};
+
+//! Returns the position of the lowest set bit of a non-zero word, through a de Bruijn sequence.
+inline uint32_t devLowestBit(uint64_t word) noexcept {
+	static constexpr uint8_t positions[64] = {
+		0, 1, 48, 2, 57, 49, 28, 3, 61, 58, 50, 42, 38, 29, 17, 4, 62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12, 5,
+		63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11, 46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19, 9, 13, 8, 7, 6
+	};
+	return positions[((word & (~word + 1)) * 0x03f79d71b4cb0a89ULL) >> 58];
+}
+
+/********!
+ * @class c_BatchSearch
+ *
+ * @brief
+ * Reusable state for the traversals that answer a whole batch of starting slots in one pass over a frozen graph (see
+ * c_GraphCSR::multiSourceBfs and c_GraphCSR::bitParallelBfs). As with c_PathSearch, starting a new query does not clear
+ * or reallocate anything once the arrays have grown to the size of the graph, and the results of the last query can be
+ * read back from it afterwards.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_BatchSearch {
+	//! Distance (and source) reported for slots that were not reached by the last query.
+	static constexpr uint32_t unreached = (uint32_t)(-1);
+	//! The largest number of sources a bit-parallel query can take: one per bit of a word.
+	static constexpr uint32_t max_sources = 64;
+	// Multi-source state: the distance and nearest source of each slot, valid where 'seen' is marked.
+	std::vector<uint32_t> order, dist, nearest;
+	c_VisitStamps seen;
+	// Bit-parallel state: each word holds one bit per source. 'current' and 'next' are all zero between queries, and
+	// 'reached' is only non-zero for the slots listed in 'touched'.
+	std::vector<uint64_t> reached, current, next;
+	std::vector<uint32_t> touched, frontier, upcoming, pair_dist;
+	uint32_t sources = 0;
+
+	//! Starts a new multi-source query over at least the specified number of slots.
+	void beginNearest(uint32_t slots) {
+		if (this->dist.size() < slots) {
+			this->dist.resize(slots);
+			this->nearest.resize(slots);
+		}
+		this->seen.begin(slots);
+		this->order.clear();
+	}
+	//! Starts a new bit-parallel query from the specified number of sources, over at least the specified number of slots.
+	//! The distances of every source to every slot are only kept if @c distances is TRUE.
+	void beginBits(uint32_t slots, uint32_t count, bool distances) {
+		for (uint32_t i : this->touched) {
+			this->reached[i] = 0;
+		}
+		this->touched.clear();
+		if (this->reached.size() < slots) {
+			this->reached.resize(slots, 0);
+			this->current.resize(slots, 0);
+			this->next.resize(slots, 0);
+		}
+		this->frontier.clear();
+		this->upcoming.clear();
+		this->sources = count;
+		if (distances) {
+			this->pair_dist.resize((uint64_t)(slots) * count);
+		} else {
+			this->pair_dist.clear();
+		}
+	}
+	//! Returns the distance of the slot from its nearest source in the last multi-source query, or @c unreached.
+	uint32_t distance(uint32_t slot) const noexcept {
+		if ((slot >= this->seen.size()) || !this->seen.test(slot)) {
+			return unreached;
+		}
+		return this->dist[slot];
+	}
+	//! Returns the position (within the sources of the last multi-source query) of the nearest source of the slot, or
+	//! @c unreached. Of several sources at the same distance, the one listed first wins.
+	uint32_t nearestSource(uint32_t slot) const noexcept {
+		if ((slot >= this->seen.size()) || !this->seen.test(slot)) {
+			return unreached;
+		}
+		return this->nearest[slot];
+	}
+	//! Returns the sources of the last bit-parallel query that reach the slot, with bit @c i standing for source @c i.
+	uint64_t reachedBy(uint32_t slot) const noexcept {
+		return (slot < this->reached.size()) ? this->reached[slot] : 0;
+	}
+	//! Returns the distance of the slot from the specified source of the last bit-parallel query, or @c unreached if the
+	//! source does not reach it or the distances were not kept.
+	uint32_t distanceFrom(uint32_t source, uint32_t slot) const noexcept {
+		if ((source >= this->sources) || this->pair_dist.empty() || !((this->reachedBy(slot) >> source) & 1)) {
+			return unreached;
+		}
+		return this->pair_dist[((uint64_t)(slot) * this->sources) + source];
+	}
+};
+
+/********!
+ * @class c_CsrArray
+ *
+ * @brief
+ * Array storage for the frozen graph structure. It either owns its elements, in a vector (and exposes the few vector
+ * operations that the snapshot is built with), or views elements owned by something else, such as a memory-mapped file
+ * (see GraphFile.hpp). Reads go through a single pointer either way, so the traversals are the same for both; modifying
+ * a viewing array first copies the viewed elements into its own storage.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+template<typename T> class c_CsrArray {
+	std::vector<T> store;
+	const T* ptr = nullptr;
+	uint32_t length = 0;
+	bool viewing = false;
+	
+	void sync() noexcept {
+		this->ptr = this->store.data();
+		this->length = this->store.size();
+	}
+	void own() {
+		if (this->viewing) {
+			this->store.assign(this->ptr, this->ptr + this->length);
+			this->viewing = false;
+			this->sync();
+		}
+	}
+public:
+	c_CsrArray() = default;
+	c_CsrArray(const c_CsrArray& other) : store(other.store), viewing(other.viewing) {
+		if (this->viewing) {
+			this->ptr = other.ptr;
+			this->length = other.length;
+		} else {
+			this->sync();
+		}
+	}
+	c_CsrArray& operator=(const c_CsrArray& other) {
+		if (this != &other) {
+			this->store = other.store;
+			this->viewing = other.viewing;
+			if (this->viewing) {
+				this->ptr = other.ptr;
+				this->length = other.length;
+			} else {
+				this->sync();
+			}
+		}
+		return *this;
+	}
+	
+	//! Points the array at elements owned elsewhere, which must outlive it (or its next modification), dropping its own.
+	void view(const T* elements, uint32_t size) {
+		this->store.clear();
+		this->ptr = elements;
+		this->length = size;
+		this->viewing = true;
+	}
+	//! Returns TRUE if the array views elements owned elsewhere.
+	bool isView() const noexcept {
+		return this->viewing;
+	}
+	uint32_t size() const noexcept {
+		return this->length;
+	}
+	bool empty() const noexcept {
+		return this->length == 0;
+	}
+	const T* data() const noexcept {
+		return this->ptr;
+	}
+	const T* begin() const noexcept {
+		return this->ptr;
+	}
+	const T* end() const noexcept {
+		return this->ptr + this->length;
+	}
+	const T& back() const noexcept {
+		return this->ptr[this->length - 1];
+	}
+	const T& operator[](uint32_t i) const noexcept {
+		return this->ptr[i];
+	}
+	T& operator[](uint32_t i) {
+		this->own();
+		return this->store[i];
+	}
+	void push_back(const T& value) {
+		this->own();
+		this->store.push_back(value);
+		this->sync();
+	}
+	void reserve(uint32_t size) {
+		this->own();
+		this->store.reserve(size);
+		this->sync();
+	}
+	void resize(uint32_t size) {
+		this->own();
+		this->store.resize(size);
+		this->sync();
+	}
+	void assign(uint32_t size, const T& value) {
+		this->viewing = false;
+		this->store.assign(size, value);
+		this->sync();
+	}
+	//! Copies the specified elements into the array's own storage.
+	void assign(const T* first, const T* last) {
+		this->viewing = false;
+		this->store.assign(first, last);
+		this->sync();
+	}
+	void clear() noexcept {
+		this->viewing = false;
+		this->store.clear();
+		this->sync();
+	}
+};
+
+/********!
+ * @class c_GraphCSR
+ *
+ * @brief
+ * A frozen, read-only snapshot of a graph structure in Compressed Sparse Row form. Each node is referred to by its slot
+ * (its position within the graph it was frozen from), and the outbound connections of a node are stored contiguously in
+ * @c targets from @c offsets[slot] up to (but excluding) @c offsets[slot + 1]. When requested, @c priorities runs parallel
+ * to @c targets; otherwise it is left empty. Traversals on this structure operate purely on those arrays and return slots,
+ * which can be mapped back through @c ids (node indexes) or @c nodes (the original node pointers). The inbound
+ * connections can optionally be stored the same way, in @c in_offsets and @c in_sources (see buildInbound).
+ *
+ * @date
+ * 14 October 2026
+ ********/
+template<typename NodeData> struct c_GraphCSR {
+	c_CsrArray<uint32_t> offsets, targets, ids;
+	c_CsrArray<uint32_t> in_offsets, in_sources;
+	c_CsrArray<uint8_t> priorities;
+	std::vector<c_GraphNode<NodeData>*> nodes; // Empty when the snapshot was not frozen from a live graph.
+	c_CsrArray<uint32_t> index_table, index_keys; // The arrays of the c_IdIndex mapping node indexes (IDs) to slots.
+	bool index_hashed = false;
+
+	//! Returns the number of nodes in the snapshot.
+	uint32_t nodeCount() const noexcept {
+		return this->ids.size();
+	}
+	//! Returns the number of connections in the snapshot.
+	uint32_t edgeCount() const noexcept {
+		return this->targets.size();
+	}
+	//! Returns the slot of the node with the specified index (ID), or -1 if it is not present.
+	uint32_t findSlot(uint32_t ID) const noexcept {
+		return c_IdIndex::lookup(this->index_table.data(), this->index_keys.data(), this->index_table.size(), this->index_hashed, ID);
+	}
+	//! Empties the snapshot.
+	void clear() noexcept {
+		this->offsets.clear();
+		this->targets.clear();
+		this->ids.clear();
+		this->in_offsets.clear();
+		this->in_sources.clear();
+		this->priorities.clear();
+		this->nodes.clear();
+		this->index_table.clear();
+		this->index_keys.clear();
+		this->index_hashed = false;
+	}
+	//! Returns TRUE if the inbound connection arrays are present.
+	bool hasInbound() const noexcept {
+		return !this->in_offsets.empty();
+	}
+	//! (Re)builds the inbound connection arrays from the outbound ones, such that the sources of the connections into a
+	//! slot are stored in @c in_sources from @c in_offsets[slot] up to @c in_offsets[slot + 1], in ascending source order.
+	void buildInbound() {
+		const uint32_t size = this->nodeCount();
+		const c_CsrArray<uint32_t>& out_offsets = this->offsets, & out_targets = this->targets;
+		std::vector<uint32_t> counts(size + 1, 0), sources(this->edgeCount());
+		for (uint32_t target : out_targets) {
+			counts[target + 1]++;
+		}
+		for (uint32_t i=0; i < size; i++) {
+			counts[i + 1] += counts[i];
+		}
+		std::vector<uint32_t> fill(counts.begin(), counts.end() - 1);
+		for (uint32_t i=0; i < size; i++) {
+			for (uint32_t e = out_offsets[i]; e < out_offsets[i + 1]; e++) {
+				sources[fill[out_targets[e]]++] = i;
+			}
+		}
+		this->in_offsets.assign(counts.data(), counts.data() + counts.size());
+		this->in_sources.assign(sources.data(), sources.data() + sources.size());
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a Breadth-First traversal over the snapshot from the specified slot, in the same order that it would be
+	 *  	performed on the original graph.
+	 * @param [in] slot_start
+	 *  	The slot to begin the BFS from.
+	 * @param [in] visited
+	 *  	Optional, long-lived visited set to reuse for this query. If null, a temporary one is allocated.
+	 * @return
+	 *  	The breadth-first ordered vector of slots, or an empty vector if the slot is invalid.
+	 ********/
+	std::vector<uint32_t> traverseBfs(uint32_t slot_start, c_VisitStamps* visited = nullptr) const {
+		const uint32_t size = this->nodeCount();
+		if (slot_start >= size) {
+			return {};
+		}
+		c_VisitStamps local;
+		c_VisitStamps& seen = (visited != nullptr) ? *visited : local;
+		seen.begin(size);
+		std::vector<uint32_t> output;
+		// The output vector doubles as the queue; everything before 'head' has already been expanded.
+		output.push_back(slot_start);
+		seen.testAdd(slot_start);
+		for (uint32_t head = 0; head < output.size(); head++) {
+			const uint32_t current = output[head];
+			for (uint32_t e = this->offsets[current]; e < this->offsets[current + 1]; e++) {
+				const uint32_t next = this->targets[e];
+				if (seen.testAdd(next)) {
+					output.push_back(next);
+				}
+			}
+		}
+		return output;
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a Depth-First traversal over the snapshot from the specified slot, in the same order that it would be
+	 *  	performed on the original graph. Uses an explicit stack rather than recursion.
+	 * @param [in] slot_start
+	 *  	The slot to begin the DFS from.
+	 * @param [in] visited
+	 *  	Optional, long-lived visited set to reuse for this query. If null, a temporary one is allocated.
+	 * @param [in] order
+	 *  	Whether slots are emitted in pre-order (when reached) or post-order (when finished).
+	 * @return
+	 *  	The depth-first ordered vector of slots, or an empty vector if the slot is invalid.
+	 ********/
+	std::vector<uint32_t> traverseDfs(uint32_t slot_start, c_VisitStamps* visited = nullptr, e_DfsOrder order = e_DfsOrder::PreOrder) const {
+		const uint32_t size = this->nodeCount();
+		if (slot_start >= size) {
+			return {};
+		}
+		c_VisitStamps local;
+		c_VisitStamps& seen = (visited != nullptr) ? *visited : local;
+		seen.begin(size);
+		const bool post = (order == e_DfsOrder::PostOrder);
+		std::vector<uint32_t> output, stack, cursor;
+		if (!post) output.push_back(slot_start);
+		seen.testAdd(slot_start);
+		stack.push_back(slot_start);
+		cursor.push_back(this->offsets[slot_start]);
+		while (!stack.empty()) {
+			const uint32_t current = stack.back();
+			uint32_t& e = cursor.back();
+			if (e == this->offsets[current + 1]) {
+				if (post) output.push_back(current);
+				stack.pop_back();
+				cursor.pop_back();
+				continue;
+			}
+			const uint32_t next = this->targets[e];
+			e++;
+			if (seen.testAdd(next)) {
+				if (!post) output.push_back(next);
+				stack.push_back(next);
+				cursor.push_back(this->offsets[next]);
+			}
+		}
+		return output;
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a Breadth-First traversal over the snapshot from the specified slot, in the same order as traverseBfs, but
+	 *  	hands each slot to a visitor as it is discovered instead of collecting an output vector. Once the scratch state
+	 *  	has grown to the size of the graph, the traversal does no allocation.
+	 * @param [in] slot_start
+	 *  	The slot to begin the BFS from.
+	 * @param [in] visitor
+	 *  	Callable taking the discovering slot (-1 for @c slot_start) and the discovered slot, and returning an e_Visit.
+	 * @param [in] search
+	 *  	Long-lived scratch state to run the traversal in.
+	 * @return
+	 *  	Returns TRUE if the traversal ran to completion, or FALSE if the visitor stopped it (or the slot is invalid).
+	 ********/
+	template<typename Visitor> bool visitBfs(uint32_t slot_start, Visitor visitor, c_SlotSearch& search) const {
+		const uint32_t size = this->nodeCount();
+		if (slot_start >= size) {
+			return false;
+		}
+		search.visited.begin(size);
+		std::vector<uint32_t>& queue = search.queue;
+		queue.clear();
+		search.visited.testAdd(slot_start);
+		const e_Visit first = visitor((uint32_t)(-1), slot_start);
+		if (first == e_Visit::Stop) return false;
+		if (first == e_Visit::Continue) queue.push_back(slot_start);
+		for (uint32_t head = 0; head < queue.size(); head++) {
+			const uint32_t current = queue[head];
+			for (uint32_t e = this->offsets[current]; e < this->offsets[current + 1]; e++) {
+				const uint32_t next = this->targets[e];
+				if (search.visited.testAdd(next)) {
+					const e_Visit action = visitor(current, next);
+					if (action == e_Visit::Stop) return false;
+					if (action == e_Visit::Continue) queue.push_back(next);
+				}
+			}
+		}
+		return true;
+	}
+	//! Runs a Depth-First traversal over the snapshot from the specified slot, in the same (pre-)order as traverseDfs, but
+	//! hands each slot to a visitor as it is reached; the same as visitBfs otherwise.
+	template<typename Visitor> bool visitDfs(uint32_t slot_start, Visitor visitor, c_SlotSearch& search) const {
+		const uint32_t size = this->nodeCount();
+		if (slot_start >= size) {
+			return false;
+		}
+		search.visited.begin(size);
+		std::vector<uint32_t>& stack = search.queue, & cursor = search.cursor;
+		stack.clear();
+		cursor.clear();
+		search.visited.testAdd(slot_start);
+		const e_Visit first = visitor((uint32_t)(-1), slot_start);
+		if (first == e_Visit::Stop) return false;
+		if (first == e_Visit::Continue) {
+			stack.push_back(slot_start);
+			cursor.push_back(this->offsets[slot_start]);
+		}
+		while (!stack.empty()) {
+			const uint32_t current = stack.back();
+			uint32_t& e = cursor.back();
+			if (e == this->offsets[current + 1]) {
+				stack.pop_back();
+				cursor.pop_back();
+				continue;
+			}
+			const uint32_t next = this->targets[e];
+			e++;
+			if (search.visited.testAdd(next)) {
+				const e_Visit action = visitor(current, next);
+				if (action == e_Visit::Stop) return false;
+				if (action == e_Visit::Continue) {
+					stack.push_back(next);
+					cursor.push_back(this->offsets[next]);
+				}
+			}
+		}
+		return true;
+	}
+	
+	//! Returns the weight of the connection at the specified position in @c targets: its priority, or 1 without priorities.
+	uint32_t weight(uint32_t edge) const noexcept {
+		return this->priorities.empty() ? 1 : this->priorities[edge];
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a best-first shortest-path search on a binary heap from the specified slot, with connections weighted by
+	 *  	weight(). Every slot is keyed by its tentative distance plus the heuristic's estimate of its remaining distance, so
+	 *  	this is Dijkstra's algorithm for c_NoHeuristic and A* otherwise. Stops as soon as the target is settled.
+	 * @param [in] slot_start
+	 *  	The (valid) slot to begin the search from.
+	 * @param [in] slot_target
+	 *  	The slot to stop at once it is settled, or -1 to settle every reachable slot.
+	 * @param [in] search
+	 *  	The search state to run the query in, which then holds its results.
+	 * @param [in] heuristic
+	 *  	Callable taking a slot and returning a lower bound of its distance to the target, which must be consistent (it
+	 *  	never drops by more than the weight of a connection) for the settled distances to be exact.
+	 ********/
+	template<typename Heuristic> void runHeapSearch(uint32_t slot_start, uint32_t slot_target, c_PathSearch& search, Heuristic& heuristic) const {
+		search.begin(this->nodeCount(), slot_start);
+		search.push(heuristic(slot_start), slot_start);
+		while (!search.heap.empty()) {
+			const uint32_t current = search.pop().slot;
+			// Stale entries (left behind when a slot's distance was lowered) are skipped once the slot is settled.
+			if (!search.settled.testAdd(current)) continue;
+			if (current == slot_target) break;
+			const uint64_t base = search.dist[current];
+			for (uint32_t e = this->offsets[current]; e < this->offsets[current + 1]; e++) {
+				const uint32_t next = this->targets[e];
+				if (!search.settled.test(next) && search.relax(next, base + this->weight(e), current)) {
+					search.push(search.dist[next] + heuristic(next), next);
+				}
+			}
+		}
+	}
+	//! Runs Dial's shortest-path search from the specified slot, stopping once the target (or -1 for none) is settled.
+	//! Connection weights never exceed 255, so every pending distance lies within 256 of the current one and each of the
+	//! 256 buckets holds exactly one distance at a time.
+	void runBucketSearch(uint32_t slot_start, uint32_t slot_target, c_PathSearch& search) const {
+		search.begin(this->nodeCount(), slot_start);
+		search.buckets[0].push_back(slot_start);
+		uint64_t pending = 1;
+		for (uint64_t current_dist = 0; pending != 0;) {
+			std::vector<uint32_t>& bucket = search.buckets[current_dist & 255];
+			if (bucket.empty()) {
+				current_dist++;
+				continue;
+			}
+			const uint32_t current = bucket.back();
+			bucket.pop_back();
+			pending--;
+			if (!search.settled.testAdd(current)) continue;
+			if (current == slot_target) break;
+			for (uint32_t e = this->offsets[current]; e < this->offsets[current + 1]; e++) {
+				const uint32_t next = this->targets[e];
+				const uint64_t next_dist = current_dist + this->weight(e);
+				if (!search.settled.test(next) && search.relax(next, next_dist, current)) {
+					search.buckets[next_dist & 255].push_back(next);
+					pending++;
+				}
+			}
+		}
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Finds the shortest path between two slots, with connections weighted by their priority (see weight()). The
+	 *  	search stops as soon as the target is settled.
+	 * @param [in] slot_start
+	 *  	The slot to begin the search from.
+	 * @param [in] slot_target
+	 *  	The slot to find the path to.
+	 * @param [in] search
+	 *  	Long-lived search state for the query, from which the path can then be read (see c_PathSearch::pathTo).
+	 * @param [in] queue
+	 *  	Whether to run Dijkstra's algorithm on a binary heap or Dial's algorithm on buckets; the latter is usually
+	 *  	faster, since the weights are small.
+	 * @return
+	 *  	The length of the shortest path, or c_PathSearch::unreached if there is none or either slot is invalid.
+	 ********/
+	uint64_t shortestPath(uint32_t slot_start, uint32_t slot_target, c_PathSearch& search, e_PathQueue queue = e_PathQueue::BinaryHeap) const {
+		if ((slot_start >= this->nodeCount()) || (slot_target >= this->nodeCount())) {
+			return c_PathSearch::unreached;
+		}
+		if (queue == e_PathQueue::Buckets) {
+			this->runBucketSearch(slot_start, slot_target, search);
+		} else {
+			c_NoHeuristic none;
+			this->runHeapSearch(slot_start, slot_target, search, none);
+		}
+		return search.distance(slot_target);
+	}
+	//! Finds the shortest paths from a slot to every slot reachable from it, which can then be read from @c search.
+	//! Returns the number of slots reached (including the first one), or zero if the slot is invalid.
+	uint32_t shortestPaths(uint32_t slot_start, c_PathSearch& search, e_PathQueue queue = e_PathQueue::BinaryHeap) const {
+		if (slot_start >= this->nodeCount()) {
+			return 0;
+		}
+		if (queue == e_PathQueue::Buckets) {
+			this->runBucketSearch(slot_start, -1, search);
+		} else {
+			c_NoHeuristic none;
+			this->runHeapSearch(slot_start, -1, search, none);
+		}
+		uint32_t reached = 0;
+		for (uint32_t i=0; i < this->nodeCount(); i++) {
+			if (search.settled.test(i)) reached++;
+		}
+		return reached;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs one Breadth-First traversal from all of the specified slots at once, which labels every slot reachable from
+	 *  	any of them with its distance from the nearest one, and with which one that is. This answers the whole batch in
+	 *  	a single pass over the connections, instead of one traversal per source.
+	 * @param [in] slots
+	 *  	The slots to begin from. Invalid slots are skipped, and repeated ones count as their first occurrence.
+	 * @param [in] count
+	 *  	The number of slots in @c slots.
+	 * @param [in] search
+	 *  	Long-lived search state for the query, from which the results can then be read (see c_BatchSearch::distance and
+	 *  	c_BatchSearch::nearestSource); @c search.order lists the reached slots in breadth-first order.
+	 * @return
+	 *  	The number of slots reached (including the sources).
+	 ********/
+	uint32_t multiSourceBfs(const uint32_t* slots, uint32_t count, c_BatchSearch& search) const {
+		const uint32_t size = this->nodeCount();
+		search.beginNearest(size);
+		// As in traverseBfs, the order vector doubles as the queue.
+		std::vector<uint32_t>& order = search.order;
+		for (uint32_t i=0; i < count; i++) {
+			if ((slots[i] < size) && search.seen.testAdd(slots[i])) {
+				search.dist[slots[i]] = 0;
+				search.nearest[slots[i]] = i;
+				order.push_back(slots[i]);
+			}
+		}
+		for (uint32_t head = 0; head < order.size(); head++) {
+			const uint32_t current = order[head], level = search.dist[current] + 1, source = search.nearest[current];
+			for (uint32_t e = this->offsets[current]; e < this->offsets[current + 1]; e++) {
+				const uint32_t next = this->targets[e];
+				if (search.seen.testAdd(next)) {
+					search.dist[next] = level;
+					search.nearest[next] = source;
+					order.push_back(next);
+				}
+			}
+		}
+		return order.size();
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a Breadth-First traversal from each of up to 64 slots together, with one bit per source packed into a word
+	 *  	for every slot. A slot in the frontier passes all of the sources that reached it at that level to its connections
+	 *  	with a single AND-NOT and OR, so the sources share one pass over the connections, and each slot is expanded at
+	 *  	most once per level rather than once per source.
+	 * @note
+	 *  	The sharing depends on the sources reaching slots at the same levels, as when the graph has a small diameter or
+	 *  	the sources lie close together. Distant sources on a long, thin graph (such as a large grid) reach each slot at
+	 *  	different levels, so it ends up expanded about as often as with one traversal per source.
+	 * @param [in] slots
+	 *  	The slots to begin from; source @c i is @c slots[i]. Invalid slots are skipped (their sources reach nothing).
+	 * @param [in] count
+	 *  	The number of slots in @c slots, at most c_BatchSearch::max_sources.
+	 * @param [in] search
+	 *  	Long-lived search state for the query, from which the results can then be read (see c_BatchSearch::reachedBy
+	 *  	and c_BatchSearch::distanceFrom); @c search.touched lists the reached slots in the order they were first reached.
+	 * @param [in] distances
+	 *  	If TRUE, the distance of every source to every slot it reaches is also recorded, which needs @c count words per
+	 *  	slot. Otherwise only which sources reach each slot is.
+	 * @return
+	 *  	The number of slots reached by at least one source, or zero if there are too many sources.
+	 ********/
+	uint32_t bitParallelBfs(const uint32_t* slots, uint32_t count, c_BatchSearch& search, bool distances = false) const {
+		const uint32_t size = this->nodeCount();
+		if (count > c_BatchSearch::max_sources) {
+			search.beginBits(size, 0, false);
+			return 0;
+		}
+		search.beginBits(size, count, distances);
+		uint64_t* const reached = search.reached.data();
+		uint64_t* current = search.current.data(), * next = search.next.data();
+		uint32_t* const pairs = search.pair_dist.data();
+		std::vector<uint32_t>& frontier = search.frontier, & upcoming = search.upcoming, & touched = search.touched;
+		for (uint32_t i=0; i < count; i++) {
+			const uint32_t slot = slots[i];
+			if (slot >= size) {
+				continue;
+			}
+			if (reached[slot] == 0) {
+				touched.push_back(slot);
+				frontier.push_back(slot);
+			}
+			reached[slot] |= (uint64_t)(1) << i;
+			current[slot] |= (uint64_t)(1) << i;
+			if (distances) pairs[((uint64_t)(slot) * count) + i] = 0;
+		}
+		for (uint32_t level = 1; !frontier.empty(); level++) {
+			for (uint32_t u : frontier) {
+				const uint64_t bits = current[u];
+				for (uint32_t e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+					const uint32_t v = this->targets[e];
+					const uint64_t fresh = bits & ~reached[v];
+					if (fresh != 0) {
+						if (reached[v] == 0) touched.push_back(v);
+						if (next[v] == 0) upcoming.push_back(v);
+						reached[v] |= fresh;
+						next[v] |= fresh;
+					}
+				}
+			}
+			// Every word of 'current' outside the frontier is already zero, so this leaves all of it zero.
+			for (uint32_t u : frontier) {
+				current[u] = 0;
+			}
+			if (distances) {
+				for (uint32_t v : upcoming) {
+					for (uint64_t bits = next[v]; bits != 0; bits &= bits - 1) {
+						pairs[((uint64_t)(v) * count) + devLowestBit(bits)] = level;
+					}
+				}
+			}
+			uint64_t* const swap = current;
+			current = next;
+			next = swap;
+			frontier.swap(upcoming);
+			upcoming.clear();
+		}
+		return touched.size();
+	}
+	//! Finds the shortest path between two slots with A*, guided by a callable taking a slot and returning a consistent
+	//! lower bound of its distance to the target (see runHeapSearch). Returns the length, or c_PathSearch::unreached.
+	template<typename Heuristic> uint64_t shortestPathAStar(uint32_t slot_start, uint32_t slot_target, Heuristic heuristic, c_PathSearch& search) const {
+		if ((slot_start >= this->nodeCount()) || (slot_target >= this->nodeCount())) {
+			return c_PathSearch::unreached;
+		}
+		this->runHeapSearch(slot_start, slot_target, search, heuristic);
+		return search.distance(slot_target);
+	}
+
+#ifdef ERC_GRAPH_PARALLEL
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Runs a level-synchronous Breadth-First traversal over the snapshot from the specified slot, expanding each level's
+	 *  	frontier across a set of worker threads. The frontier is split into chunks that the threads claim dynamically, and
+	 *  	each chunk collects the nodes it discovers in its own local list; the lists are stitched together in chunk order
+	 *  	once the level is complete.
+	 * @param [in] slot_start
+	 *  	The slot to begin the BFS from.
+	 * @param [in] threads
+	 *  	The number of threads to use, including the calling thread. Set to zero to use one per hardware thread.
+	 * @param [in] relaxed
+	 *  	If FALSE, the output is exactly the order produced by traverseBfs: every discovered node is first claimed by the
+	 *  	earliest (frontier position, connection) pair that reaches it, and only then emitted. If TRUE, the first thread to
+	 *  	reach a node claims it with a single atomic operation, so the order within each level may vary between runs; in
+	 *  	this mode, when the inbound arrays are present (see buildInbound), large frontiers are expanded bottom-up instead,
+	 *  	with every unvisited node searching its inbound connections for a member of the frontier.
+	 * @param [out] levels
+	 *  	If non-null, overwritten with the level (distance from @c slot_start) of each slot, parallel to the output.
+	 * @return
+	 *  	The breadth-first ordered vector of slots, or an empty vector if the slot is invalid.
+	 ********/
+	std::vector<uint32_t> traverseBfsParallel(uint32_t slot_start, uint32_t threads = 0, bool relaxed = false, std::vector<uint32_t>* levels = nullptr) const {
+		const uint32_t size = this->nodeCount();
+		if (levels != nullptr) levels->clear();
+		if (slot_start >= size) {
+			return {};
+		}
+		threads = devParallelThreads(threads);
+		const uint32_t unseen = -1;
+		const bool canFlip = relaxed && this->hasInbound();
+		std::vector<std::atomic<uint32_t>> dist(size);
+		std::vector<std::atomic<uint64_t>> owner(relaxed ? 0 : size);
+		std::vector<std::vector<uint32_t>> chunk_out;
+		std::vector<uint32_t> output;
+		output.reserve(size);
+		
+		// Level state, only written by thread 0 between barriers.
+		uint32_t level = 0, front_begin = 0, front_end = 0, chunk_size = 1, chunk_count = 0;
+		uint64_t edges_left = this->edgeCount();
+		bool bottom_up = false, done = false;
+		std::atomic<uint32_t> next_chunk(0);
+		c_SpinBarrier barrier(threads);
+		
+		// Sets up the chunks for the level that is about to be expanded.
+		auto plan = [&]() {
+			const uint32_t items = bottom_up ? size : (front_end - front_begin);
+			const uint32_t minimum = bottom_up ? 1024 : 64;
+			chunk_size = items / (threads * (bottom_up ? 16 : 8));
+			if (chunk_size < minimum) chunk_size = minimum;
+			chunk_count = (items + chunk_size - 1) / chunk_size;
+			if (chunk_out.size() < chunk_count) chunk_out.resize(chunk_count);
+			next_chunk.store(0, std::memory_order_relaxed);
+		};
+		// Appends the discoveries of the level in chunk order, then decides how the next level is expanded.
+		auto merge = [&]() {
+			front_begin = front_end;
+			uint64_t frontier_edges = 0;
+			for (uint32_t c=0; c < chunk_count; c++) {
+				for (uint32_t v : chunk_out[c]) {
+					output.push_back(v);
+					if (levels != nullptr) levels->push_back(level);
+					frontier_edges += this->offsets[v + 1] - this->offsets[v];
+				}
+				chunk_out[c].clear();
+			}
+			front_end = output.size();
+			if (front_begin == front_end) {
+				done = true;
+				return;
+			}
+			edges_left = (edges_left > frontier_edges) ? (edges_left - frontier_edges) : 0;
+			if (canFlip) {
+				if (!bottom_up && (frontier_edges * 14 > edges_left)) {
+					bottom_up = true;
+				} else if (bottom_up && ((uint64_t)(front_end - front_begin) * 24 < size)) {
+					bottom_up = false;
+				}
+			}
+			level++;
+			plan();
+		};
+		// Claims 'dest' for the current level on behalf of the specified (frontier position, connection) pair.
+		auto claimMin = [&](uint32_t dest, uint64_t key) {
+			uint64_t seen = owner[dest].load(std::memory_order_relaxed);
+			while (key < seen && !owner[dest].compare_exchange_weak(seen, key, std::memory_order_relaxed)) {}
+		};
+		
+		auto work = [&](uint32_t t) {
+			const uint32_t first = (uint64_t)(size) * t / threads, last = (uint64_t)(size) * (t + 1) / threads;
+			for (uint32_t v = first; v < last; v++) {
+				dist[v].store(unseen, std::memory_order_relaxed);
+				if (!relaxed) owner[v].store(-1, std::memory_order_relaxed);
+			}
+			barrier.arrive();
+			if (t == 0) {
+				dist[slot_start].store(0, std::memory_order_relaxed);
+				output.push_back(slot_start);
+				if (levels != nullptr) levels->push_back(0);
+				front_end = 1;
+				level = 1;
+				plan();
+			}
+			barrier.arrive();
+			while (!done) {
+				for (uint32_t c; (c = next_chunk.fetch_add(1, std::memory_order_relaxed)) < chunk_count;) {
+					const uint32_t lo = c * chunk_size;
+					if (bottom_up) {
+						const uint32_t hi = (lo + chunk_size < size) ? (lo + chunk_size) : size;
+						for (uint32_t v = lo; v < hi; v++) {
+							if (dist[v].load(std::memory_order_relaxed) != unseen) continue;
+							for (uint32_t e = this->in_offsets[v]; e < this->in_offsets[v + 1]; e++) {
+								if (dist[this->in_sources[e]].load(std::memory_order_relaxed) == level - 1) {
+									dist[v].store(level, std::memory_order_relaxed);
+									chunk_out[c].push_back(v);
+									break;
+								}
+							}
+						}
+						continue;
+					}
+					const uint32_t hi = (front_begin + lo + chunk_size < front_end) ? (front_begin + lo + chunk_size) : front_end;
+					for (uint32_t i = front_begin + lo; i < hi; i++) {
+						const uint32_t u = output[i];
+						for (uint32_t e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+							const uint32_t v = this->targets[e];
+							if (dist[v].load(std::memory_order_relaxed) != unseen) continue;
+							if (relaxed) {
+								uint32_t expected = unseen;
+								if (dist[v].compare_exchange_strong(expected, level, std::memory_order_relaxed)) {
+									chunk_out[c].push_back(v);
+								}
+							} else {
+								claimMin(v, ((uint64_t)(i) << 32) | (e - this->offsets[u]));
+							}
+						}
+					}
+				}
+				barrier.arrive();
+				if (!relaxed && !bottom_up) {
+					// Second pass: each node is emitted by the pair that won it, which reproduces the sequential order.
+					if (t == 0) next_chunk.store(0, std::memory_order_relaxed);
+					barrier.arrive();
+					for (uint32_t c; (c = next_chunk.fetch_add(1, std::memory_order_relaxed)) < chunk_count;) {
+						const uint32_t lo = front_begin + c * chunk_size;
+						const uint32_t hi = (lo + chunk_size < front_end) ? (lo + chunk_size) : front_end;
+						for (uint32_t i = lo; i < hi; i++) {
+							const uint32_t u = output[i];
+							for (uint32_t e = this->offsets[u]; e < this->offsets[u + 1]; e++) {
+								const uint32_t v = this->targets[e];
+								if ((owner[v].load(std::memory_order_relaxed) == (((uint64_t)(i) << 32) | (e - this->offsets[u])))
+									&& (dist[v].load(std::memory_order_relaxed) == unseen)) {
+									dist[v].store(level, std::memory_order_relaxed);
+									chunk_out[c].push_back(v);
+								}
+							}
+						}
+					}
+					barrier.arrive();
+				}
+				if (t == 0) merge();
+				barrier.arrive();
+			}
+		};
+		devRunThreads(threads, work);
+		return output;
+	}
+#endif
+};
+
+//! How a c_Graph allocates the memory for its nodes.
+enum class e_NodeAlloc : uint8_t {
+	Heap,	//!< Each node is created with @c new and destroyed with @c delete (the default).
+	Arena	//!< Nodes are placed in contiguous slabs from a c_NodeArena, and the slabs are released in bulk.
+};
+
+/********!
+ * @class c_NodeArena
+ *
+ * @brief
+ * Slab allocator for graph nodes. Nodes are constructed in place within large, contiguous slabs that grow geometrically,
+ * so constructing many nodes costs a handful of allocations, and nodes created together sit next to each other in memory.
+ * Slabs are never moved or resized, so node pointers remain stable for the life of the arena. Destroyed nodes are kept on
+ * a free list for reuse; releasing the arena frees all slabs at once, without running any destructors.
+ *
+ * @date
+ * 14 October 2026
+ ********/
+template<typename NodeData> class c_NodeArena {
+	using Node = c_GraphNode<NodeData>;
+	struct c_Slab {
+		Node* base;
+		uint32_t capacity;
+	};
+	std::vector<c_Slab> slabs;
+	std::vector<Node*> free_list;
+	uint32_t used = 0; // Number of nodes handed out from the newest slab.
+public:
+	c_NodeArena() {}
+	c_NodeArena(const c_NodeArena&) = delete;
+	c_NodeArena& operator=(const c_NodeArena&) = delete;
+	//! Frees every slab. Any nodes still alive within them must have been destroyed beforehand.
+	~c_NodeArena() {
+		this->release();
+	}
+	//! Ensures that the next @c nodes creations will not need more than one new slab.
+	void reserve(uint32_t nodes) {
+		const uint32_t spare = this->slabs.empty() ? 0 : (this->slabs.back().capacity - this->used);
+		if (nodes > spare + this->free_list.size()) {
+			this->grow(nodes - this->free_list.size());
+		}
+	}
+	//! Constructs a new node within the arena.
+	Node* create(uint32_t id, const NodeData& val) {
+		void* memory;
+		if (!this->free_list.empty()) {
+			memory = this->free_list.back();
+			this->free_list.pop_back();
+		} else {
+			if (this->slabs.empty() || (this->used == this->slabs.back().capacity)) {
+				this->grow(0);
+			}
+			memory = this->slabs.back().base + this->used;
+			this->used++;
+		}
+		return new (memory) Node(id, val);
+	}
+	//! Destroys a node that was created by this arena, keeping its memory for reuse.
+	void destroy(Node* node) {
+		node->~Node();
+		this->free_list.push_back(node);
+	}
+	//! Frees every slab at once. Any nodes still alive within them must have been destroyed beforehand.
+	void release() noexcept {
+		for (c_Slab& i : this->slabs) {
+			::operator delete(i.base, std::align_val_t(alignof(Node)));
+		}
+		this->slabs.clear();
+		this->free_list.clear();
+		this->used = 0;
+	}
+private:
+	void grow(uint32_t atLeast) {
+		uint32_t capacity = this->slabs.empty() ? 64 : this->slabs.back().capacity * 2;
+		if (capacity > 65536) capacity = 65536;
+		if (capacity < atLeast) capacity = atLeast;
+		Node* base = static_cast<Node*>(::operator new(sizeof(Node) * (std::size_t)(capacity), std::align_val_t(alignof(Node))));
+		this->slabs.push_back({base, capacity});
+		this->used = 0;
+	}
+};
+
+/********!
+ * @class c_GraphNode
+ * 
+ * @brief
+ * Represents a combined graph structure, with multiple means of construction and with some utility handlers. Supports the
+ * storage and optimization of up to 4,294,967,290 unique nodes. Every run* and visit* traversal searches with a header of
+ * its own (or one supplied by the caller), so traversals may nest or run concurrently on an unchanging graph. Only the
+ * shortest-path queries and the batched traversals share internal search state (so that they do not allocate their arrays
+ * per query), and must not be called concurrently on the same graph.
+ * 
+ * @date
+ * 30 October 2024
+ ********/
+template<typename NodeData> class c_Graph {
+	std::vector<c_GraphNode<NodeData>*> raw_ptrs;
+	std::vector<c_GraphCnt> calc_cnts;
+	std::vector<uint32_t> degrees, indexes; // BOTH of these vectors are aligned with the order of raw_ptrs, not the node indexes!
+	uint32_t count = 0;
+	c_IdIndex id_index; // Maps each node index (ID) to its position in raw_ptrs.
+	c_NodeArena<NodeData> arena; // Only used when node_alloc is e_NodeAlloc::Arena.
+	e_NodeAlloc node_alloc = e_NodeAlloc::Heap;
+	c_GraphCSR<NodeData> frozen;
+	bool frozen_valid = false;
+	bool frozen_unweighted = false; // Set when the snapshot was made for the shortest paths without priorities, as no connection has one.
+	c_PathSearch pathing; // Reused by every shortest-path query, so that queries do not allocate their arrays.
+	c_BatchSearch batching; // Reused by every batched traversal, for the same reason.
+	c_EdgeIndex edge_index; // Maps each connection to its position in calc_cnts, for the incremental updates.
+	bool edge_index_valid = false;
+#ifdef ERC_GRAPH_STATS
+	c_TraversalStats last_stats;
+	mutable std::mutex stats_lock; // Guards last_stats, since traversals may run on several threads at once.
+	c_FuncHook_Shared<void, const c_TraversalStats&> stats_observer{devDiscardStats};
+	// Hands the header's statistics for the traversal that just ended to the observer, and then copies them as the last
+	// statistics, leaving them in the header too for a caller that supplied it (the copy reuses the capacity of last_stats).
+	void publishStats(c_SearchHeader<NodeData>& header, std::chrono::steady_clock::duration elapsed) {
+		header.stats.elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+		this->stats_observer.call(header.stats);
+		const std::lock_guard<std::mutex> hold(this->stats_lock);
+		this->last_stats = header.stats;
+	}
+#endif
+	// Times one run* traversal through its search header, and publishes its statistics once it goes out of scope. It is
+	// empty, and compiles away, unless ERC_GRAPH_STATS is defined.
+	class c_StatsScope {
+#ifdef ERC_GRAPH_STATS
+		c_Graph* const graph;
+		c_SearchHeader<NodeData>& header;
+		const std::chrono::steady_clock::time_point begun;
+	public:
+		c_StatsScope(c_Graph* const owner, c_SearchHeader<NodeData>& search) : graph(owner), header(search), begun(std::chrono::steady_clock::now()) {}
+		~c_StatsScope() {
+			this->graph->publishStats(this->header, std::chrono::steady_clock::now() - this->begun);
+		}
+#else
+	public:
+		c_StatsScope(c_Graph* const, c_SearchHeader<NodeData>&) noexcept {}
+#endif
+	};
+	// Allows ID mapping in O(1) time through 'id_index', which is kept in step with 'indexes' and 'raw_ptrs'.
+	// Returns -1 (4294967295 for uint32_t) if the ID provided is not in the graph.
+	uint32_t idxMap(uint32_t ID) const noexcept {
+		return this->id_index.find(ID);
+	}
+	// Creates a node through the graph's allocation policy and registers it in the next slot, which is returned.
+	// Does not update 'count'.
+	uint32_t makeNode(uint32_t ID, const NodeData& val) {
+		c_GraphNode<NodeData>* node = (this->node_alloc == e_NodeAlloc::Arena) ? this->arena.create(ID, val) : new c_GraphNode<NodeData>(ID, val);
+		const uint32_t slot = this->raw_ptrs.size();
+		node->slot = slot;
+		this->raw_ptrs.push_back(node);
+		this->indexes.push_back(ID);
+		this->id_index.insert(ID, slot);
+		return slot;
+	}
+	// (Re)builds the connection index from calc_cnts if anything replaced the list since it was last built.
+	void ensureEdgeIndex() {
+		if (this->edge_index_valid) {
+			return;
+		}
+		this->edge_index.clear();
+		this->edge_index.reserve(this->calc_cnts.size());
+		for (uint32_t i=0; i < this->calc_cnts.size(); i++) {
+			this->edge_index.insert(c_EdgeIndex::keyOf(this->calc_cnts[i].from, this->calc_cnts[i].to), i);
+		}
+		this->edge_index_valid = true;
+	}
+	// Removes the entry at the specified position of calc_cnts by moving the last entry into it, keeping the index in step.
+	void eraseCnt(uint32_t position) {
+		const uint32_t last = this->calc_cnts.size() - 1;
+		this->edge_index.erase(c_EdgeIndex::keyOf(this->calc_cnts[position].from, this->calc_cnts[position].to), position);
+		if (position != last) {
+			this->edge_index.move(c_EdgeIndex::keyOf(this->calc_cnts[last].from, this->calc_cnts[last].to), last, position);
+			this->calc_cnts[position] = this->calc_cnts[last];
+		}
+		this->calc_cnts.pop_back();
+	}
+	// Removes the first instance of the node from a connection vector by moving the last entry into it. Returns TRUE if found.
+	static bool unlinkCnt(std::vector<c_GraphNode<NodeData>*>& list, const c_GraphNode<NodeData>* other) noexcept {
+		for (uint32_t i=0; i < list.size(); i++) {
+			if (list[i] == other) {
+				list[i] = list.back();
+				list.pop_back();
+				return true;
+			}
+		}
+		return false;
+	}
+	// Rebuilds the snapshot for the shortest-path searches if it is stale or lacks the priorities, which freeze() only
+	// takes if at least one connection has a priority; otherwise every connection weighs 1 (see c_GraphCSR::weight).
+	void freezeForPaths() {
+		if (this->frozen_valid && (!this->frozen.priorities.empty() || this->frozen_unweighted)) {
+			return;
+		}
+		this->freeze(true, this->frozen.hasInbound());
+	}
+	// Appends the nodes along the last shortest path found to the specified vector, if any.
+	void appendPath(uint32_t target, std::vector<c_GraphNode<NodeData>*>* path) {
+		if (path == nullptr) {
+			return;
+		}
+		std::vector<uint32_t> slots;
+		this->pathing.pathTo(target, slots);
+		for (uint32_t i : slots) {
+			path->push_back(this->raw_ptrs[i]);
+		}
+	}
+	// Destroys a node through the graph's allocation policy. Does not unregister it.
+	void dropNode(c_GraphNode<NodeData>* node) {
+		if (this->node_alloc == e_NodeAlloc::Arena) {
+			this->arena.destroy(node);
+		} else {
+			delete node;
+		}
+	}
+	// Removes the repeated outgoing and incoming connections of a node in place, keeping the first of each in its original
+	// order. The stamps must cover every slot of the graph; runs in O(degree) with no allocation. Connections to nodes
+	// that do not sit in their slot of this graph (such as nodes of another graph) cannot be marked by slot, so they are
+	// compared by address with the connections kept so far instead.
+	void compactCnts(c_GraphNode<NodeData>* node, c_VisitStamps& seen) const {
+		std::vector<c_GraphNode<NodeData>*>* lists[2] = {&node->cnt_out, &node->cnt_in};
+		for (std::vector<c_GraphNode<NodeData>*>* list : lists) {
+			seen.begin(seen.size());
+			uint32_t kept = 0;
+			for (c_GraphNode<NodeData>* other : *list) {
+				bool fresh = true;
+				if ((other->slot < this->count) && (this->raw_ptrs[other->slot] == other)) {
+					fresh = seen.testAdd(other->slot);
+				} else {
+					for (uint32_t i=0; fresh && (i < kept); i++) {
+						fresh = (*list)[i] != other;
+					}
+				}
+				if (fresh) {
+					(*list)[kept++] = other;
+				}
+			}
+			list->resize(kept);
+		}
+	}
+	// Compacts the connections of every node (see compactCnts), splitting the nodes across threads for large graphs when
+	// ERC_GRAPH_PARALLEL is defined, then recalculates the degrees. Returns the total number of connections left.
+	uint32_t compactAllCnts() {
+#ifdef ERC_GRAPH_PARALLEL
+		const uint32_t threads = devParallelThreads(0);
+		if ((threads > 1) && (this->count >= 16384)) {
+			const uint32_t chunk_size = 1024;
+			std::atomic<uint32_t> next_chunk(0);
+			auto work = [this, &next_chunk, chunk_size](uint32_t) {
+				c_VisitStamps seen;
+				seen.begin(this->count);
+				for (uint32_t lo; (lo = next_chunk.fetch_add(chunk_size, std::memory_order_relaxed)) < this->count;) {
+					const uint32_t hi = (lo + chunk_size < this->count) ? (lo + chunk_size) : this->count;
+					for (uint32_t i = lo; i < hi; i++) {
+						this->compactCnts(this->raw_ptrs[i], seen);
+					}
+				}
+			};
+			devRunThreads(threads, work);
+		} else
+#endif
+		{
+			c_VisitStamps seen;
+			seen.begin(this->count);
+			for (uint32_t i=0; i < this->count; i++) {
+				this->compactCnts(this->raw_ptrs[i], seen);
+			}
+		}
+		calcDegrees();
+		uint32_t total = 0;
+		for (uint32_t i : this->degrees) {
+			total += i;
+		}
+		return total;
+	}
+public:
+	//! Initialize an empty graph structure, optionally specifying how its nodes will be allocated.
+	c_Graph(e_NodeAlloc alloc = e_NodeAlloc::Heap) : node_alloc(alloc) {}
+	//! Initialize a pre-filled graph structure, where all nodes share the same value. All connections added must be specified.
+	//! Connections will be processed and nodes will be created as needed for the indexes present.
+	//! Report connections, at least for the initializer list, as {ID_from, ID_to, priority} or just {ID_from, ID_to}.
+	//! With e_NodeAlloc::Arena, the nodes are placed in contiguous slabs instead of being allocated one by one.
+	c_Graph(const NodeData prefill, std::initializer_list<c_GraphCnt> connectionList, e_NodeAlloc alloc = e_NodeAlloc::Heap) : node_alloc(alloc) {
+		this->buildEdges(prefill, connectionList.begin(), connectionList.end());
+	}
+	//! Initialize a pre-filled graph structure from an iterator pair of connections (anything that yields c_GraphCnt), in the
+	//! same fashion as the initializer list constructor. See buildEdges for the requirements and the deduplication option.
+	template<typename Iter> c_Graph(const NodeData prefill, Iter first, Iter last, bool dedupe = false, e_NodeAlloc alloc = e_NodeAlloc::Heap) : node_alloc(alloc) {
+		this->buildEdges(prefill, first, last, dedupe);
+	}
+	// later, add one htat lets you generate data based on a function; function takes the node's index as only param, and returns a valid NodeData
+	
+	//! Deletes the structure, calling the @c delete method for each node to prevent memory leaks. Arena-allocated nodes are
+	//! destroyed in place, and their slabs are then freed in bulk.
+	~c_Graph() {
+		for (uint32_t i=0; i < this->count; i++) {
+			if (this->node_alloc == e_NodeAlloc::Arena) {
+				this->raw_ptrs.at(i)->~c_GraphNode<NodeData>();
+			} else {
+				delete this->raw_ptrs.at(i);
+			}
+		}
+		this->raw_ptrs.clear();
+		this->arena.release();
+	}
+	//! Returns how the graph allocates its nodes.
+	e_NodeAlloc allocationPolicy() const noexcept {
+		return this->node_alloc;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Adds a batch of connections to the graph in bulk, creating nodes (with the @c prefill value) as needed for the
+	 *  	indexes present, in the order they first appear. The connections are read twice: the first pass creates the nodes
+	 *  	and counts the degrees of each, so that every node's connection vectors are reserved exactly once, and the second
+	 *  	pass fills them.
+	 * @param [in] prefill
+	 *  	The value to give to any newly-created node.
+	 * @param [in] first, last
+	 *  	The range of connections, which must be readable more than once (a forward iterator or better).
+	 * @param [in] dedupe
+	 *  	If FALSE, the connections are added exactly as the initializer list constructor would add them, and are listed
+	 *  	in the connections vector in their original order. If TRUE, they are instead grouped by their origin node, and
+	 *  	any connection that is a duplicate (of an earlier one in the batch or of one already in the graph) or that
+	 *  	connects a node to itself is dropped, keeping the priority of the first occurrence; the graph is then as
+	 *  	optimizeCnts would leave it, without needing to call it.
+	 * @return
+	 *  	The number of connections in the graph's connections vector.
+	 ********/
+	template<typename Iter> uint32_t buildEdges(const NodeData prefill, Iter first, Iter last, bool dedupe = false) {
+		this->frozen_valid = false;
+		this->edge_index_valid = false;
+		const uint32_t existing = this->raw_ptrs.size();
+		std::vector<uint32_t> outCount(existing, 0), inCount(existing, 0);
+		uint64_t taken = 0;
+		for (Iter it = first; it != last; ++it) {
+			const c_GraphCnt TMP = *it;
+			uint32_t i = idxMap(TMP.from);
+			if ((i == 4294967293) || (i == (uint32_t)(-1))) {
+				i = makeNode(TMP.from, prefill);
+				outCount.push_back(0); inCount.push_back(0);
+			}
+			uint32_t j = idxMap(TMP.to);
 			if ((j == 4294967293) || (j == (uint32_t)(-1))) {
-				indexes.push_back(TMP.to);
-				raw_ptrs.push_back(new c_GraphNode<NodeData>(TMP.to, prefill));
-				j = indexes.size() - 1;
+				j = makeNode(TMP.to, prefill);
+				outCount.push_back(0); inCount.push_back(0);
 			}
-			raw_ptrs.at(i)->establishCnt(raw_ptrs.at(j));
-			calc_cnts.push_back(TMP);
+			if (i != j) {
+				outCount[i]++;
+				inCount[j]++;
+			}
+			taken++;
 			// Hit upper limit for nodes in some fashion
 			if (i >= 4294967290 || j >= 4294967290) {
 				break;
 			}
 		}
-		count = raw_ptrs.size();
-		calcDegrees();
+		this->count = this->raw_ptrs.size();
+		for (uint32_t i=0; i < this->count; i++) {
+			c_GraphNode<NodeData>* node = this->raw_ptrs[i];
+			node->cnt_out.reserve(node->cnt_out.size() + outCount[i]);
+			node->cnt_in.reserve(node->cnt_in.size() + inCount[i]);
+		}
+		
+		if (!dedupe) {
+			this->calc_cnts.reserve(this->calc_cnts.size() + taken);
+			Iter it = first;
+			for (uint64_t n=0; n < taken; n++, ++it) {
+				const c_GraphCnt TMP = *it;
+				c_GraphNode<NodeData>* from = this->raw_ptrs[idxMap(TMP.from)], * to = this->raw_ptrs[idxMap(TMP.to)];
+				if (from != to) {
+					from->cnt_out.push_back(to);
+					to->cnt_in.push_back(from);
+				}
+				this->calc_cnts.push_back(TMP);
+			}
+			calcDegrees();
+			return this->calc_cnts.size();
+		}
+		
+		// Group the batch by origin slot (a counting sort on the degrees from the first pass), then filter each group.
+		std::vector<uint32_t> start(this->count + 1, 0);
+		for (uint32_t i=0; i < this->count; i++) {
+			start[i + 1] = start[i] + outCount[i];
+		}
+		std::vector<uint32_t> groupTo(start[this->count]);
+		std::vector<uint8_t> groupPrio(start[this->count]);
+		{
+			std::vector<uint32_t> fill(start.begin(), start.end() - 1);
+			Iter it = first;
+			for (uint64_t n=0; n < taken; n++, ++it) {
+				const c_GraphCnt TMP = *it;
+				const uint32_t i = idxMap(TMP.from), j = idxMap(TMP.to);
+				if (i != j) {
+					groupTo[fill[i]] = j;
+					groupPrio[fill[i]] = TMP.priority;
+					fill[i]++;
+				}
+			}
+		}
+		c_VisitStamps seen;
+		for (uint32_t i=0; i < this->count; i++) {
+			if (start[i] == start[i + 1]) continue;
+			c_GraphNode<NodeData>* from = this->raw_ptrs[i];
+			seen.begin(this->count);
+			// Only nodes of this graph can match a new connection, and a node of another one may hold any slot.
+			for (c_GraphNode<NodeData>* node : from->cnt_out) {
+				if ((node->slot < this->count) && (this->raw_ptrs[node->slot] == node)) {
+					seen.testAdd(node->slot);
+				}
+			}
+			for (uint32_t e = start[i]; e < start[i + 1]; e++) {
+				if (seen.testAdd(groupTo[e])) {
+					c_GraphNode<NodeData>* to = this->raw_ptrs[groupTo[e]];
+					from->cnt_out.push_back(to);
+					to->cnt_in.push_back(from);
+					this->calc_cnts.push_back({from->index, to->index, groupPrio[e]});
+				}
+			}
+		}
+		calcDegrees();
+		return this->calc_cnts.size();
+	}
+	//! Adds a batch of connections to the graph in bulk from any range of c_GraphCnt (such as a vector). See the iterator
+	//! overload for details.
+	template<typename Range> uint32_t buildEdges(const NodeData prefill, const Range& connections, bool dedupe = false) {
+		return this->buildEdges(prefill, connections.begin(), connections.end(), dedupe);
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Adds a batch of connections to the graph, creating nodes (with the @c prefill value) as needed for the indexes
+	 *  	present, and updating the connection vectors, the degrees, and the connections list in step. Connections from a
+	 *  	node to itself are ignored.
+	 * @param [in] prefill
+	 *  	The value to give to any newly-created node.
+	 * @param [in] first, last
+	 *  	The range of connections to add.
+	 * @param [in] allowDuplicates
+	 *  	If FALSE, connections that are already present in the graph are skipped.
+	 * @return
+	 *  	The number of connections added.
+	 * @note
+	 *  	Runs in time linear to the size of the batch. The first incremental update after the connections list has been
+	 *  	rebuilt (by construction, buildEdges, or optimizeCnts) indexes the list once, in time linear to its size.
+	 ********/
+	template<typename Iter> uint32_t addEdges(const NodeData prefill, Iter first, Iter last, bool allowDuplicates = false) {
+		this->ensureEdgeIndex();
+		this->frozen_valid = false;
+		uint32_t added = 0;
+		for (Iter it = first; it != last; ++it) {
+			const c_GraphCnt TMP = *it;
+			uint32_t i = idxMap(TMP.from);
+			if (i == (uint32_t)(-1)) {
+				i = makeNode(TMP.from, prefill);
+				this->degrees.push_back(0);
+				this->count++;
+			}
+			uint32_t j = idxMap(TMP.to);
+			if (j == (uint32_t)(-1)) {
+				j = makeNode(TMP.to, prefill);
+				this->degrees.push_back(0);
+				this->count++;
+			}
+			const uint64_t key = c_EdgeIndex::keyOf(TMP.from, TMP.to);
+			if ((i == j) || (!allowDuplicates && (this->edge_index.find(key) != (uint32_t)(-1)))) {
+				continue;
+			}
+			this->raw_ptrs[i]->cnt_out.push_back(this->raw_ptrs[j]);
+			this->raw_ptrs[j]->cnt_in.push_back(this->raw_ptrs[i]);
+			this->degrees[i]++;
+			this->edge_index.insert(key, this->calc_cnts.size());
+			this->calc_cnts.push_back(TMP);
+			added++;
+		}
+		return added;
+	}
+	//! Adds a batch of connections from any range of c_GraphCnt. See the iterator overload for details.
+	template<typename Range> uint32_t addEdges(const NodeData prefill, const Range& connections, bool allowDuplicates = false) {
+		return this->addEdges(prefill, connections.begin(), connections.end(), allowDuplicates);
+	}
+	//! Adds a batch of connections, reported as {ID_from, ID_to, priority} or just {ID_from, ID_to}. See the iterator overload.
+	uint32_t addEdges(const NodeData prefill, std::initializer_list<c_GraphCnt> connections, bool allowDuplicates = false) {
+		return this->addEdges(prefill, connections.begin(), connections.end(), allowDuplicates);
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Removes a batch of connections from the graph (one instance each, in the rare case that duplicates exist),
+	 *  	updating the connection vectors, the degrees, and the connections list in step. Priorities are not compared.
+	 * @param [in] first, last
+	 *  	The range of connections to remove.
+	 * @return
+	 *  	The number of connections removed.
+	 * @note
+	 *  	The removed entries are replaced by the last entry of each vector rather than erased in order, so the order of
+	 *  	the connections list and of the affected nodes' connections will change. Each removal takes constant time for the
+	 *  	connections list, plus a scan of the two nodes' connection vectors.
+	 ********/
+	template<typename Iter> uint32_t removeEdges(Iter first, Iter last) {
+		this->ensureEdgeIndex();
+		this->frozen_valid = false;
+		uint32_t removed = 0;
+		for (Iter it = first; it != last; ++it) {
+			const c_GraphCnt TMP = *it;
+			const uint32_t position = this->edge_index.find(c_EdgeIndex::keyOf(TMP.from, TMP.to));
+			if (position == (uint32_t)(-1)) {
+				continue;
+			}
+			this->eraseCnt(position);
+			removed++;
+			const uint32_t i = idxMap(TMP.from), j = idxMap(TMP.to);
+			if ((i == (uint32_t)(-1)) || (j == (uint32_t)(-1)) || (i == j)) {
+				continue;
+			}
+			if (unlinkCnt(this->raw_ptrs[i]->cnt_out, this->raw_ptrs[j])) {
+				this->degrees[i]--;
+			}
+			unlinkCnt(this->raw_ptrs[j]->cnt_in, this->raw_ptrs[i]);
+		}
+		return removed;
+	}
+	//! Removes a batch of connections from any range of c_GraphCnt. See the iterator overload for details.
+	template<typename Range> uint32_t removeEdges(const Range& connections) {
+		return this->removeEdges(connections.begin(), connections.end());
+	}
+	//! Removes a batch of connections, reported as {ID_from, ID_to}. See the iterator overload for details.
+	uint32_t removeEdges(std::initializer_list<c_GraphCnt> connections) {
+		return this->removeEdges(connections.begin(), connections.end());
+	}
+	
+	//! Adds a batch of unconnected nodes with the specified indexes (IDs) and value, skipping any index already present.
+	//! Returns the number of nodes added.
+	template<typename Iter> uint32_t addNodes(const NodeData prefill, Iter first, Iter last) {
+		uint32_t added = 0;
+		for (Iter it = first; it != last; ++it) {
+			if (idxMap(*it) != (uint32_t)(-1)) {
+				continue;
+			}
+			makeNode(*it, prefill);
+			this->degrees.push_back(0);
+			this->count++;
+			added++;
+		}
+		if (added != 0) {
+			this->frozen_valid = false;
+		}
+		return added;
+	}
+	//! Adds a batch of unconnected nodes from any range of indexes (IDs). See the iterator overload for details.
+	template<typename Range> uint32_t addNodes(const NodeData prefill, const Range& IDs) {
+		return this->addNodes(prefill, IDs.begin(), IDs.end());
+	}
+	//! Adds a batch of unconnected nodes from a list of indexes (IDs). See the iterator overload for details.
+	uint32_t addNodes(const NodeData prefill, std::initializer_list<uint32_t> IDs) {
+		return this->addNodes(prefill, IDs.begin(), IDs.end());
 	}
-	// later, add one htat lets you generate data based on a function; function takes the node's index as only param, and returns a valid NodeData
 	
-	//! Deletes the structure, calling the @c delete method for each node to prevent memory leaks.
-	~c_Graph() {
-		for (uint32_t i=0; i < this->count; i++) {
-			delete this->raw_ptrs.at(i);
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Removes a batch of nodes from the graph, along with every connection to or from them, keeping the connection
+	 *  	vectors, the degrees, the connections list, and the index mapping in step. Indexes that are not present are skipped.
+	 * @param [in] first, last
+	 *  	The range of node indexes (IDs) to remove.
+	 * @return
+	 *  	The number of nodes removed.
+	 * @note
+	 *  	The last node of the graph is moved into the slot of each removed node, so the slots (see findSlot) of other
+	 *  	nodes can change. Takes time linear to the connections of the removed nodes and of their neighbours.
+	 ********/
+	template<typename Iter> uint32_t removeNodes(Iter first, Iter last) {
+		this->ensureEdgeIndex();
+		uint32_t removed = 0;
+		for (Iter it = first; it != last; ++it) {
+			const uint32_t ID = *it, slot = idxMap(ID);
+			if (slot == (uint32_t)(-1)) {
+				continue;
+			}
+			c_GraphNode<NodeData>* node = this->raw_ptrs[slot];
+			uint32_t position;
+			// Nodes linked in from outside the graph are unlinked too, but they have no degree or connections listed here,
+			// and one of them may share an ID with a node of this graph.
+			for (c_GraphNode<NodeData>* other : node->cnt_out) {
+				unlinkCnt(other->cnt_in, node);
+				if ((other->slot < this->count) && (this->raw_ptrs[other->slot] == other)
+					&& ((position = this->edge_index.find(c_EdgeIndex::keyOf(ID, other->index))) != (uint32_t)(-1))) {
+					this->eraseCnt(position);
+				}
+			}
+			for (c_GraphNode<NodeData>* other : node->cnt_in) {
+				const bool owned = (other->slot < this->count) && (this->raw_ptrs[other->slot] == other);
+				if (unlinkCnt(other->cnt_out, node) && owned) {
+					this->degrees[other->slot]--;
+				}
+				if (owned && ((position = this->edge_index.find(c_EdgeIndex::keyOf(other->index, ID))) != (uint32_t)(-1))) {
+					this->eraseCnt(position);
+				}
+			}
+			while ((position = this->edge_index.find(c_EdgeIndex::keyOf(ID, ID))) != (uint32_t)(-1)) {
+				this->eraseCnt(position);
+			}
+			
+			// Move the last node into the freed slot.
+			const uint32_t end = this->count - 1;
+			c_GraphNode<NodeData>* moved = this->raw_ptrs[end];
+			this->raw_ptrs[slot] = moved;
+			this->indexes[slot] = this->indexes[end];
+			this->degrees[slot] = this->degrees[end];
+			moved->slot = slot;
+			this->raw_ptrs.pop_back();
+			this->indexes.pop_back();
+			this->degrees.pop_back();
+			this->id_index.erase(ID);
+			if (slot != end) {
+				this->id_index.insert(moved->index, slot);
+			}
+			this->count--;
+			this->dropNode(node);
+			removed++;
 		}
-		this->raw_ptrs.clear();
+		if (removed != 0) {
+			this->frozen_valid = false;
+		}
+		return removed;
+	}
+	//! Removes a batch of nodes from any range of indexes (IDs). See the iterator overload for details.
+	template<typename Range> uint32_t removeNodes(const Range& IDs) {
+		return this->removeNodes(IDs.begin(), IDs.end());
+	}
+	//! Removes a batch of nodes from a list of indexes (IDs). See the iterator overload for details.
+	uint32_t removeNodes(std::initializer_list<uint32_t> IDs) {
+		return this->removeNodes(IDs.begin(), IDs.end());
 	}
 	//! Calculates the external degree of each node in the structure, and returns the largest encountered.
 	uint32_t calcDegrees() {
@@ -507,6 +2559,111 @@ public:
 	const std::vector<c_GraphCnt>& viewConnections() const noexcept {
 		return this->calc_cnts;
 	}
+	//! Returns the slot (position within the graph) of the node with the specified index (ID), or -1 if it is not present.
+	uint32_t findSlot(uint32_t ID) const noexcept {
+		return this->idxMap(ID);
+	}
+	//! Returns the node with the specified index (ID), or nullptr if it is not present.
+	c_GraphNode<NodeData>* findNode(uint32_t ID) const noexcept {
+		const uint32_t slot = this->idxMap(ID);
+		return (slot == (uint32_t)(-1)) ? nullptr : this->raw_ptrs[slot];
+	}
+	//! Returns TRUE if the last snapshot made by freeze() still reflects the graph's connections.
+	bool isFrozen() const noexcept {
+		return this->frozen_valid;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	(Re)builds the read-only Compressed Sparse Row snapshot of the graph from the current nodes and connections, for
+	 *  	use in read-heavy traversal. Slots within the snapshot match the order of the nodes within the graph.
+	 * @param [in] withPriorities
+	 *  	Whether to fill the parallel priority array from the connections list (see optimizeCnts). It is left empty if no
+	 *  	connection has a priority, so that every connection weighs 1 (see c_GraphCSR::weight) rather than 0.
+	 * @param [in] withInbound
+	 *  	Whether to also build the inbound connection arrays (see c_GraphCSR::buildInbound).
+	 * @return
+	 *  	A read-only reference to the snapshot, which remains owned by the graph.
+	 * @note
+	 *  	Modifying connections (including through optimizeCnts) makes the snapshot stale; check isFrozen() and call this
+	 *  	again to rebuild it after mutation.
+	 ********/
+	const c_GraphCSR<NodeData>& freeze(bool withPriorities = true, bool withInbound = false) {
+		c_GraphCSR<NodeData>& csr = this->frozen;
+		csr.clear();
+		csr.offsets.reserve(this->count + 1);
+		csr.ids.reserve(this->count);
+		csr.nodes.reserve(this->count);
+		uint32_t total = 0;
+		for (uint32_t i=0; i < this->count; i++) {
+			total += this->raw_ptrs.at(i)->externalDegree();
+		}
+		csr.targets.reserve(total);
+		for (uint32_t i=0; i < this->count; i++) {
+			c_GraphNode<NodeData>* tmp = this->raw_ptrs.at(i);
+			csr.offsets.push_back(csr.targets.size());
+			csr.ids.push_back(tmp->index);
+			csr.nodes.push_back(tmp);
+			for (c_GraphNode<NodeData>* node : tmp->cnt_out) {
+				csr.targets.push_back(node->slot);
+			}
+		}
+		csr.offsets.push_back(csr.targets.size());
+		csr.index_table.assign(this->id_index.table.data(), this->id_index.table.data() + this->id_index.table.size());
+		csr.index_keys.assign(this->id_index.keys.data(), this->id_index.keys.data() + this->id_index.keys.size());
+		csr.index_hashed = this->id_index.hashed;
+		
+		bool weighted = false;
+		for (uint32_t c=0; withPriorities && !weighted && (c < this->calc_cnts.size()); c++) {
+			weighted = this->calc_cnts[c].priority != 0;
+		}
+		this->frozen_unweighted = withPriorities && !weighted;
+		if (weighted) {
+			// Connections are matched to edges by position: the k-th connection from one node to another takes the k-th edge
+			// between them, so repeated connections keep their own priorities. The connections are first grouped by their
+			// source; then, for each node, 'chain' links each of its edges to the next one with the same target, and 'head'
+			// holds the first unmatched edge to each target slot.
+			const uint32_t none = -1, size = this->calc_cnts.size();
+			csr.priorities.assign(total, 0);
+			std::vector<uint32_t> from(size), to(size), first(this->count + 1, 0), grouped(size);
+			std::vector<uint32_t> chain(total), head(this->count, none);
+			for (uint32_t c=0; c < size; c++) {
+				from[c] = this->idxMap(this->calc_cnts[c].from);
+				to[c] = this->idxMap(this->calc_cnts[c].to);
+				if ((from[c] != none) && (to[c] != none)) first[from[c] + 1]++;
+			}
+			for (uint32_t i=0; i < this->count; i++) {
+				first[i + 1] += first[i];
+			}
+			std::vector<uint32_t> fill(first.begin(), first.end() - 1);
+			for (uint32_t c=0; c < size; c++) {
+				if ((from[c] != none) && (to[c] != none)) grouped[fill[from[c]]++] = c;
+			}
+			for (uint32_t i=0; i < this->count; i++) {
+				const uint32_t begin = csr.offsets[i], end = csr.offsets[i + 1];
+				for (uint32_t e = end; e > begin; e--) {
+					chain[e - 1] = head[csr.targets[e - 1]];
+					head[csr.targets[e - 1]] = e - 1;
+				}
+				for (uint32_t g = first[i]; g < first[i + 1]; g++) {
+					const uint32_t c = grouped[g], e = head[to[c]];
+					if (e != none) {
+						csr.priorities[e] = this->calc_cnts[c].priority;
+						head[to[c]] = chain[e];
+					}
+				}
+				for (uint32_t e = begin; e < end; e++) {
+					head[csr.targets[e]] = none;
+				}
+			}
+		}
+		if (withInbound) {
+			csr.buildInbound();
+		}
+		this->frozen_valid = true;
+		return csr;
+	}
 	
 	/********!
 	 * @date	30 October 2024
@@ -518,43 +2675,19 @@ public:
 	 * @note
 	 *  	This will reset all connection priorities to zero. If using priorities, use the overload such that the priorities
 	 *  	can be recalculated, unless you intentionally want them all to be zero.
+	 * @note
+	 *  	Each node's connection vectors are compacted in place, keeping the first instance of every connection in order,
+	 *  	in time linear to the number of connections; with ERC_GRAPH_PARALLEL, large graphs split the nodes across threads.
 	 ********/
 	uint32_t optimizeCnts() {
+		this->frozen_valid = false;
+		this->edge_index_valid = false;
 		this->calc_cnts.clear();
+		this->calc_cnts.reserve(this->compactAllCnts());
 		for (uint32_t i=0; i < this->count; i++) {
-			c_GraphNode<NodeData>* tmp = this->raw_ptrs.at(i);
-			
-			// Test for node-level external duplicates and expunge them.
-			std::vector<uint32_t> marked = {};
-			std::vector<c_GraphNode<NodeData>*> to_sever = {};
-			uint32_t minidx = -1, maxidx = 0;
+			c_GraphNode<NodeData>* tmp = this->raw_ptrs[i];
 			for (c_GraphNode<NodeData>* node : tmp->cnt_out) {
-				bool good = true;
-				uint32_t erridx = 0;
-				// See if we can avoid the expensive iteration loop by seeing if it's out of (existing) range.
-				if (node->index < minidx) {
-					minidx = node->index;
-				} else if (node->index > maxidx) {
-					maxidx = node->index;
-				} else {
-					for (uint32_t j : marked) {
-						if (node->index == j) {
-							good = false;
-							erridx = j;
-							break;
-						}
-					}
-				}
-				if (good) {
-					marked.push_back(node->index);
-					c_GraphCnt outtmp = {tmp->index, node->index};
-					this->calc_cnts.push_back(outtmp);
-				} else {
-					to_sever.push_back(node);
-				}
-			}
-			for (c_GraphNode<NodeData>* dupl : to_sever) {
-				tmp->severCnt(dupl);
+				this->calc_cnts.push_back({tmp->index, node->index});
 			}
 		}
 		return this->calc_cnts.size();
@@ -572,42 +2705,18 @@ public:
 	 *  	must not throw an exception, and must not modify the nodes (which are passed as constant pointers).
 	 * @return
 	 *  	The newly-determined number of connections in the graph structure.
+	 * @note
+	 *  	The function is called once per remaining connection, in order, from the calling thread.
 	 ********/
 	uint32_t optimizeCnts(uint8_t (* const prioFunc)(const c_GraphNode<NodeData>*, const c_GraphNode<NodeData>*)) {
+		this->frozen_valid = false;
+		this->edge_index_valid = false;
 		this->calc_cnts.clear();
+		this->calc_cnts.reserve(this->compactAllCnts());
 		for (uint32_t i=0; i < this->count; i++) {
-			c_GraphNode<NodeData>* tmp = this->raw_ptrs.at(i);
-			
-			// Test for node-level external duplicates and expunge them.
-			std::vector<uint32_t> marked = {};
-			std::vector<c_GraphNode<NodeData>*> to_sever = {};
-			uint32_t minidx = -1, maxidx = 0;
+			c_GraphNode<NodeData>* tmp = this->raw_ptrs[i];
 			for (c_GraphNode<NodeData>* node : tmp->cnt_out) {
-				bool good = true;
-				// See if we can avoid the expensive iteration loop by seeing if it's out of (existing) range.
-				if (node->index < minidx) {
-					minidx = node->index;
-				} else if (node->index > maxidx) {
-					maxidx = node->index;
-				} else {
-					for (uint32_t j : marked) {
-						if (node->index == j) {
-							good = false;
-							break;
-						}
-					}
-				}
-				if (good) {
-					marked.push_back(node->index);
-					uint8_t prio = prioFunc(tmp, node);
-					c_GraphCnt outtmp = {tmp->index, node->index, prio};
-					this->calc_cnts.push_back(outtmp);
-				} else {
-					to_sever.push_back(node);
-				}
-			}
-			for (c_GraphNode<NodeData>* dupl : to_sever) {
-				tmp->severCnt(dupl);
+				this->calc_cnts.push_back({tmp->index, node->index, prioFunc(tmp, node)});
 			}
 		}
 		return this->calc_cnts.size();
@@ -621,16 +2730,23 @@ public:
 	 * 		target node, until all possible paths have been traversed. Performed on a node basis.
 	 * @param [in] index_start
 	 *  	The node index (ID) to begin the BFS from.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
 	 * @return
 	 *  	The organized breadth-first pointer vector.
 	 ********/
-	std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start) {
+	std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start, c_SearchHeader<NodeData>* header = nullptr) {
 		uint32_t init = this->idxMap(index_start);
 		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
 			return {};
 		}
 		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
-		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs(start_parent);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs(start_parent, &search);
 		return output;
 	}
 	/********!
@@ -643,21 +2759,125 @@ public:
 	 * @param [in] index_start
 	 *  	The node index (ID) to begin the BFS from.
 	 * @param [in] searchFunc
-	 *  	The boolean function to use for filtering the output. It must take two parameters: the previously-visited node,
-	 *  	and then the current node in question. The current node will be added to the output vector if this function
-	 *  	returns true. The function must be able to handle nullptr nodes, primarily for handling the topmost node.
+	 *  	The boolean function (or any callable, such as a capturing lambda) to use for filtering the output. It must take
+	 *  	two parameters: the previously-visited node, and then the current node in question. The current node will be
+	 *  	added to the output vector if this function returns true. The function must be able to handle nullptr nodes,
+	 *  	primarily for handling the topmost node.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	The organized breadth-first pointer vector.
+	 ********/
+	template<typename Filter> std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start, Filter searchFunc, c_SearchHeader<NodeData>* header = nullptr) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return {};
+		}
+		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs_Filt(start_parent, searchFunc, &search);
+		return output;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the entire Graph in a Breadth-First Search fashion from the indicated initial node, as with the standard
+	 *  	runBreadthFirst, while also reporting how far each node lies from the initial node.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the BFS from.
+	 * @param [out] levels
+	 *  	Overwritten with the level (number of connections from the initial node) of each node, parallel to the output.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	The organized breadth-first pointer vector.
+	 ********/
+	std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start, std::vector<uint32_t>& levels, c_SearchHeader<NodeData>* header = nullptr) {
+		levels.clear();
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return {};
+		}
+		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs(start_parent, &search, &levels);
+		return output;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the entire Graph in a Breadth-First Search fashion from the indicated initial node, filtering the output
+	 *  	results based on the searchFunc as with the filtered runBreadthFirst, while also reporting how far each output
+	 *  	node lies from the initial node.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the BFS from.
+	 * @param [in] searchFunc
+	 *  	The boolean function to use for filtering the output, with the same requirements as the filtered runBreadthFirst.
+	 * @param [out] levels
+	 *  	Overwritten with the level (number of connections from the initial node) of each output node, parallel to the output.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
 	 * @return
 	 *  	The organized breadth-first pointer vector.
 	 ********/
-	std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start, bool (* searchFunc)(c_GraphNode<NodeData>*, c_GraphNode<NodeData>*)) {
+	template<typename Filter> std::vector<c_GraphNode<NodeData>*> runBreadthFirst(uint32_t index_start, Filter searchFunc, std::vector<uint32_t>& levels, c_SearchHeader<NodeData>* header = nullptr) {
+		levels.clear();
 		uint32_t init = this->idxMap(index_start);
 		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
 			return {};
 		}
 		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
-		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs_Filt(start_parent, searchFunc);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseBfs_Filt(start_parent, searchFunc, &search, &levels);
+		return output;
+	}
+	
+#ifdef ERC_GRAPH_PARALLEL
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the entire Graph in a Breadth-First Search fashion from the indicated initial node using multiple
+	 *  	threads, through the frozen snapshot (see c_GraphCSR::traverseBfsParallel). The snapshot is rebuilt first, with
+	 *  	its inbound arrays, if it is stale or lacks them.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the BFS from.
+	 * @param [in] threads
+	 *  	The number of threads to use, including the calling thread. Set to zero to use one per hardware thread.
+	 * @param [in] relaxed
+	 *  	If TRUE, the order of nodes within each level may differ from runBreadthFirst, which allows the faster single-pass
+	 *  	claiming and the bottom-up expansion of large frontiers.
+	 * @return
+	 *  	The organized breadth-first pointer vector.
+	 ********/
+	std::vector<c_GraphNode<NodeData>*> runBreadthFirstParallel(uint32_t index_start, uint32_t threads = 0, bool relaxed = false) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return {};
+		}
+		if (!this->frozen_valid || !this->frozen.hasInbound()) {
+			this->freeze(!this->frozen.priorities.empty(), true);
+		}
+		std::vector<uint32_t> slots = this->frozen.traverseBfsParallel(init, threads, relaxed);
+		std::vector<c_GraphNode<NodeData>*> output;
+		output.reserve(slots.size());
+		for (uint32_t i : slots) {
+			output.push_back(this->raw_ptrs[i]);
+		}
 		return output;
 	}
+#endif
 	
 	/********!
 	 * @date	2 November 2024
@@ -666,16 +2886,23 @@ public:
 	 *  	to completely traverse all of a node's connections as soon as it is added to the output list. Performed on a node basis.
 	 * @param [in] index_start
 	 *  	The node index (ID) to begin the DFS from.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
 	 * @return
 	 *  	The organized depth-first pointer vector.
 	 ********/
-	std::vector<c_GraphNode<NodeData>*> runDepthFirst(uint32_t index_start) {
+	std::vector<c_GraphNode<NodeData>*> runDepthFirst(uint32_t index_start, c_SearchHeader<NodeData>* header = nullptr) {
 		uint32_t init = this->idxMap(index_start);
 		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
 			return {};
 		}
 		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
-		std::vector<c_GraphNode<NodeData>*> output = devTraverseDfs(start_parent);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseDfs(start_parent, &search);
 		return output;
 	}
 	/********!
@@ -687,21 +2914,508 @@ public:
 	 * @param [in] index_start
 	 *  	The node index (ID) to begin the DFS from.
 	 * @param [in] searchFunc
-	 *  	The boolean function to use for filtering the output. It must take two parameters: the previously-visited node,
-	 *  	and then the current node in question. The current node will be added to the output vector if this function
-	 *  	returns true. The function must be able to handle nullptr nodes, primarily for handling the topmost node.
+	 *  	The boolean function (or any callable, such as a capturing lambda) to use for filtering the output. It must take
+	 *  	two parameters: the previously-visited node, and then the current node in question. The current node will be
+	 *  	added to the output vector if this function returns true. The function must be able to handle nullptr nodes,
+	 *  	primarily for handling the topmost node.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
 	 * @return
 	 *  	The organized depth-first pointer vector.
 	 ********/
-	std::vector<c_GraphNode<NodeData>*> runDepthFirst(uint32_t index_start, bool (* searchFunc)(c_GraphNode<NodeData>*, c_GraphNode<NodeData>*)) {
+	template<typename Filter> std::vector<c_GraphNode<NodeData>*> runDepthFirst(uint32_t index_start, Filter searchFunc, c_SearchHeader<NodeData>* header = nullptr) {
 		uint32_t init = this->idxMap(index_start);
 		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
 			return {};
 		}
 		c_GraphNode<NodeData>* start_parent = this->raw_ptrs.at(init);
-		std::vector<c_GraphNode<NodeData>*> output = devTraverseDfs_Filt(start_parent, searchFunc);
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		std::vector<c_GraphNode<NodeData>*> output = devTraverseDfs_Filt(start_parent, searchFunc, &search);
 		return output;
 	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the entire Graph in a Depth-First Search fashion from the indicated initial node, appending the result
+	 *  	to an existing vector instead of building a new one.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the DFS from.
+	 * @param [out] output
+	 *  	The vector to append the traversed nodes to. Its existing contents are kept.
+	 * @param [in] order
+	 *  	Whether nodes are emitted in pre-order (when first reached, as with the standard runDepthFirst) or in post-order
+	 *  	(once all of their connections have been finished).
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	The number of nodes appended to @c output.
+	 ********/
+	uint32_t runDepthFirst(uint32_t index_start, std::vector<c_GraphNode<NodeData>*>& output, e_DfsOrder order = e_DfsOrder::PreOrder, c_SearchHeader<NodeData>* header = nullptr) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return 0;
+		}
+		const uint32_t before = output.size();
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		devTraverseDfs(this->raw_ptrs.at(init), output, order, &search);
+		return output.size() - before;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the entire Graph in a Depth-First Search fashion from the indicated initial node, filtering the results
+	 *  	based on the searchFunc and appending them to an existing vector instead of building a new one.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the DFS from.
+	 * @param [in] searchFunc
+	 *  	The boolean function to use for filtering the output, with the same requirements as the filtered runDepthFirst.
+	 * @param [out] output
+	 *  	The vector to append the accepted nodes to. Its existing contents are kept.
+	 * @param [in] order
+	 *  	Whether nodes are emitted in pre-order (when first reached) or in post-order (once all of their connections
+	 *  	have been finished).
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	The number of nodes appended to @c output.
+	 ********/
+	template<typename Filter> uint32_t runDepthFirst(uint32_t index_start, Filter searchFunc, std::vector<c_GraphNode<NodeData>*>& output, e_DfsOrder order = e_DfsOrder::PreOrder, c_SearchHeader<NodeData>* header = nullptr) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return 0;
+		}
+		const uint32_t before = output.size();
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		devTraverseDfs_Filt(this->raw_ptrs.at(init), searchFunc, output, order, &search);
+		return output.size() - before;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the Graph in a Breadth-First Search fashion from the indicated initial node, handing each node to the
+	 *  	visitor as it is discovered (see devVisitBfs) rather than building an output vector. The visitor can prune the
+	 *  	search below a node or stop it outright.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the BFS from.
+	 * @param [in] visitor
+	 *  	Callable taking the previously-visited node (nullptr for the initial node) and the current node, and returning
+	 *  	e_Visit::Continue, e_Visit::Prune, or e_Visit::Stop.
+	 * @param [in] header
+	 *  	If non-null, the search header to run the traversal with, which lets a long-lived header serve many queries
+	 *  	without allocating. It must not be in use by another traversal. Otherwise, the call uses its own.
+	 * @return
+	 *  	Returns TRUE if the traversal ran to completion, or FALSE if it was stopped or the initial node is not present.
+	 ********/
+	template<typename Visitor> bool visitBreadthFirst(uint32_t index_start, Visitor visitor, c_SearchHeader<NodeData>* header = nullptr) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return false;
+		}
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		return devVisitBfs(this->raw_ptrs.at(init), visitor, &search);
+	}
+	//! Traverses the Graph in a Depth-First Search fashion from the indicated initial node, handing each node to the visitor
+	//! as it is reached (see devVisitDfs); the same as visitBreadthFirst otherwise, including the optional search header.
+	template<typename Visitor> bool visitDepthFirst(uint32_t index_start, Visitor visitor, c_SearchHeader<NodeData>* header = nullptr) {
+		uint32_t init = this->idxMap(index_start);
+		if ((init == 4294967293) || (init == (uint32_t)(-1))) {
+			return false;
+		}
+		c_SearchHeader<NodeData> local;
+		c_SearchHeader<NodeData>& search = (header != nullptr) ? *header : local;
+		const c_StatsScope timing(this, search);
+		search.beginDense(this->count);
+		return devVisitDfs(this->raw_ptrs.at(init), visitor, &search);
+	}
+	
+#ifdef ERC_GRAPH_STATS
+	//! Returns the statistics of the most recent runBreadthFirst, runDepthFirst, visitBreadthFirst or visitDepthFirst call
+	//! that found its initial node to finish, on any thread. The multi-threaded and frozen-snapshot traversals are not recorded.
+	c_TraversalStats lastStats() const {
+		const std::lock_guard<std::mutex> hold(this->stats_lock);
+		return this->last_stats;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Returns the hook object that is called with the statistics of every traversal recorded in lastStats() as soon
+	 *  	as the traversal ends. Observers are registered on it with addHook(), and should invoke the next level; the
+	 *  	original function discards the statistics.
+	 * @note
+	 *  	Observers run inside the traversal call, on the thread that made it. They may start another traversal, which is
+	 *  	reported before the observer returns.
+	 ********/
+	c_FuncHook_Shared<void, const c_TraversalStats&>& statsObserver() noexcept {
+		return this->stats_observer;
+	}
+#endif
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Finds the shortest path between two nodes, using the connection priorities as weights, through the frozen
+	 *  	snapshot (see c_GraphCSR::shortestPath). The snapshot is rebuilt first if it is stale or lacks priorities.
+	 *  	If no connection has a priority, every connection weighs 1, so the length is the number of connections along
+	 *  	the path; otherwise, connections without one (priority 0) weigh nothing.
+	 * @param [in] index_start
+	 *  	The node index (ID) to begin the search from.
+	 * @param [in] index_target
+	 *  	The node index (ID) to find the path to.
+	 * @param [out] path
+	 *  	If non-null, the nodes along the path (from the first to the last) are appended to it.
+	 * @param [in] queue
+	 *  	Whether to run Dijkstra's algorithm on a binary heap or Dial's algorithm on buckets.
+	 * @return
+	 *  	The length of the shortest path, or c_PathSearch::unreached if there is none or either node is not present.
+	 ********/
+	uint64_t shortestPath(uint32_t index_start, uint32_t index_target, std::vector<c_GraphNode<NodeData>*>* path = nullptr, e_PathQueue queue = e_PathQueue::BinaryHeap) {
+		const uint32_t init = this->idxMap(index_start), target = this->idxMap(index_target);
+		if ((init == (uint32_t)(-1)) || (target == (uint32_t)(-1))) {
+			return c_PathSearch::unreached;
+		}
+		this->freezeForPaths();
+		const uint64_t length = this->frozen.shortestPath(init, target, this->pathing, queue);
+		this->appendPath(target, path);
+		return length;
+	}
+	//! Finds the shortest path between two nodes with A*, guided by a callable taking a constant node pointer and returning a
+	//! consistent lower bound of its distance to the target node. Otherwise the same as shortestPath.
+	template<typename Heuristic> uint64_t shortestPathAStar(uint32_t index_start, uint32_t index_target, Heuristic heuristic, std::vector<c_GraphNode<NodeData>*>* path = nullptr) {
+		const uint32_t init = this->idxMap(index_start), target = this->idxMap(index_target);
+		if ((init == (uint32_t)(-1)) || (target == (uint32_t)(-1))) {
+			return c_PathSearch::unreached;
+		}
+		this->freezeForPaths();
+		const std::vector<c_GraphNode<NodeData>*>& nodes = this->frozen.nodes;
+		const uint64_t length = this->frozen.shortestPathAStar(init, target, [&heuristic, &nodes](uint32_t slot) -> uint64_t {
+			return heuristic(static_cast<const c_GraphNode<NodeData>*>(nodes[slot]));
+		}, this->pathing);
+		this->appendPath(target, path);
+		return length;
+	}
+	//! Finds the shortest distances from a node to every node, weighting the connections as shortestPath does. The distances are
+	//! written to @c distances by slot (see findSlot), with c_PathSearch::unreached for unreachable nodes. Returns the number
+	//! of nodes reached, or zero if the node is not present.
+	uint32_t shortestPaths(uint32_t index_start, std::vector<uint64_t>& distances, e_PathQueue queue = e_PathQueue::BinaryHeap) {
+		const uint32_t init = this->idxMap(index_start);
+		if (init == (uint32_t)(-1)) {
+			return 0;
+		}
+		this->freezeForPaths();
+		const uint32_t reached = this->frozen.shortestPaths(init, this->pathing, queue);
+		distances.resize(this->count);
+		for (uint32_t i=0; i < this->count; i++) {
+			distances[i] = this->pathing.distance(i);
+		}
+		return reached;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the Graph in a Breadth-First Search fashion from all of the indicated nodes at once, through the frozen
+	 *  	snapshot (see c_GraphCSR::multiSourceBfs), which labels every node with the number of connections from the
+	 *  	nearest of them. It takes one pass however many nodes there are to start from. The snapshot is rebuilt first if
+	 *  	it is stale.
+	 * @param [in] index_starts
+	 *  	The node indexes (IDs) to begin the BFS from. Those that are not present are skipped.
+	 * @param [out] distances
+	 *  	Overwritten with the distance of each node by slot (see findSlot) from the nearest of the initial nodes, or
+	 *  	c_BatchSearch::unreached for nodes that none of them reach.
+	 * @param [out] nearest
+	 *  	If non-null, overwritten with the position within @c index_starts of the nearest initial node of each node by
+	 *  	slot, or c_BatchSearch::unreached. Of several initial nodes at the same distance, the one listed first wins.
+	 * @return
+	 *  	The number of nodes reached, including the initial nodes.
+	 ********/
+	uint32_t runBreadthFirstMulti(const std::vector<uint32_t>& index_starts, std::vector<uint32_t>& distances, std::vector<uint32_t>* nearest = nullptr) {
+		if (!this->frozen_valid) {
+			this->freeze(!this->frozen.priorities.empty(), this->frozen.hasInbound());
+		}
+		std::vector<uint32_t> slots;
+		slots.reserve(index_starts.size());
+		for (uint32_t ID : index_starts) {
+			slots.push_back(this->idxMap(ID));
+		}
+		const uint32_t reached = this->frozen.multiSourceBfs(slots.data(), slots.size(), this->batching);
+		distances.resize(this->count);
+		for (uint32_t i=0; i < this->count; i++) {
+			distances[i] = this->batching.distance(i);
+		}
+		if (nearest != nullptr) {
+			nearest->resize(this->count);
+			for (uint32_t i=0; i < this->count; i++) {
+				(*nearest)[i] = this->batching.nearestSource(i);
+			}
+		}
+		return reached;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Traverses the Graph in a Breadth-First Search fashion from each of up to 64 nodes, all in one bit-parallel pass
+	 *  	through the frozen snapshot (see c_GraphCSR::bitParallelBfs), which finds which of them reach every node and,
+	 *  	optionally, how far away each of them is. The snapshot is rebuilt first if it is stale.
+	 * @param [in] index_starts
+	 *  	The node indexes (IDs) to begin the BFS from, at most c_BatchSearch::max_sources of them. Initial nodes that are
+	 *  	not present reach nothing.
+	 * @param [out] reached
+	 *  	Overwritten with a word for each node by slot (see findSlot), in which bit @c i is set if the node is reachable
+	 *  	from @c index_starts[i].
+	 * @param [out] distances
+	 *  	If non-null, overwritten with the distance of every node from every initial node: entry
+	 *  	(slot * index_starts.size()) + i holds the distance from @c index_starts[i], or c_BatchSearch::unreached.
+	 * @return
+	 *  	The number of nodes reached by at least one of the initial nodes, or zero (with the outputs emptied) if there
+	 *  	are more than c_BatchSearch::max_sources of them.
+	 ********/
+	uint32_t runBreadthFirstBits(const std::vector<uint32_t>& index_starts, std::vector<uint64_t>& reached, std::vector<uint32_t>* distances = nullptr) {
+		const uint32_t sources = index_starts.size();
+		if (sources > c_BatchSearch::max_sources) {
+			reached.clear();
+			if (distances != nullptr) distances->clear();
+			return 0;
+		}
+		if (!this->frozen_valid) {
+			this->freeze(!this->frozen.priorities.empty(), this->frozen.hasInbound());
+		}
+		uint32_t slots[c_BatchSearch::max_sources];
+		for (uint32_t i=0; i < sources; i++) {
+			slots[i] = this->idxMap(index_starts[i]);
+		}
+		const uint32_t total = this->frozen.bitParallelBfs(slots, sources, this->batching, distances != nullptr);
+		reached.resize(this->count);
+		for (uint32_t i=0; i < this->count; i++) {
+			reached[i] = this->batching.reachedBy(i);
+		}
+		if (distances != nullptr) {
+			distances->resize((uint64_t)(this->count) * sources);
+			for (uint32_t i=0; i < this->count; i++) {
+				for (uint32_t j=0; j < sources; j++) {
+					(*distances)[((uint64_t)(i) * sources) + j] = this->batching.distanceFrom(j, i);
+				}
+			}
+		}
+		return total;
+	}
+	
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Labels the weakly connected components of the Graph, in which two nodes are joined if there is a connection
+	 *  	between them in either direction. Runs one Breadth-First pass over the outgoing and incoming connections of
+	 *  	every node from each node not yet labeled, with the labels serving as the visited set, in O(V + E) time.
+	 * @param [out] component
+	 *  	Overwritten with the component of each node by slot (see findSlot). Components are numbered from zero in the
+	 *  	order of their first slot.
+	 * @return
+	 *  	The number of weakly connected components.
+	 ********/
+	uint32_t weakComponents(std::vector<uint32_t>& component) {
+		const uint32_t unseen = -1;
+		component.assign(this->count, unseen);
+		std::vector<c_GraphNode<NodeData>*> queue;
+		uint32_t total = 0;
+		for (uint32_t root=0; root < this->count; root++) {
+			if (component[root] != unseen) {
+				continue;
+			}
+			component[root] = total;
+			queue.clear();
+			queue.push_back(this->raw_ptrs[root]);
+			for (uint32_t head=0; head < queue.size(); head++) {
+				const c_GraphNode<NodeData>* node = queue[head];
+				for (const std::vector<c_GraphNode<NodeData>*>* list : {&node->cnt_out, &node->cnt_in}) {
+					for (c_GraphNode<NodeData>* other : *list) {
+						if (component[other->slot] == unseen) {
+							component[other->slot] = total;
+							queue.push_back(other);
+						}
+					}
+				}
+			}
+			total++;
+		}
+		return total;
+	}
+#ifdef ERC_GRAPH_PARALLEL
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Labels the weakly connected components of the Graph using multiple threads, producing exactly the same labels as
+	 *  	weakComponents. The threads claim chunks of nodes and merge every node with the targets of its outgoing connections
+	 *  	in a lock-free union-find structure, in which a root is only ever linked under a smaller root (so each component
+	 *  	ends up rooted at its first slot), and paths are halved as they are searched.
+	 * @param [out] component
+	 *  	Overwritten with the component of each node by slot, numbered from zero in the order of their first slot.
+	 * @param [in] threads
+	 *  	The number of threads to use, including the calling thread. Set to zero to use one per hardware thread.
+	 * @return
+	 *  	The number of weakly connected components.
+	 ********/
+	uint32_t weakComponentsParallel(std::vector<uint32_t>& component, uint32_t threads = 0) {
+		threads = devParallelThreads(threads);
+		const uint32_t size = this->count, chunk_size = 1024;
+		std::vector<std::atomic<uint32_t>> parent(size);
+		std::atomic<uint32_t> next_chunk(0);
+		c_SpinBarrier barrier(threads);
+		auto find = [&parent](uint32_t slot) {
+			uint32_t up = parent[slot].load(std::memory_order_acquire);
+			while (up != slot) {
+				const uint32_t above = parent[up].load(std::memory_order_acquire);
+				if (above != up) {
+					parent[slot].compare_exchange_weak(up, above, std::memory_order_acq_rel);
+				}
+				slot = up;
+				up = parent[slot].load(std::memory_order_acquire);
+			}
+			return slot;
+		};
+		auto work = [&](uint32_t t) {
+			const uint32_t first = (uint64_t)(size) * t / threads, last = (uint64_t)(size) * (t + 1) / threads;
+			for (uint32_t i = first; i < last; i++) {
+				parent[i].store(i, std::memory_order_relaxed);
+			}
+			barrier.arrive();
+			for (uint32_t lo; (lo = next_chunk.fetch_add(chunk_size, std::memory_order_relaxed)) < size;) {
+				const uint32_t hi = (lo + chunk_size < size) ? (lo + chunk_size) : size;
+				for (uint32_t i = lo; i < hi; i++) {
+					for (const c_GraphNode<NodeData>* other : this->raw_ptrs[i]->cnt_out) {
+						uint32_t a = find(i), b = find(other->slot);
+						while (a != b) {
+							uint32_t high = (a > b) ? a : b, low = (a > b) ? b : a;
+							if (parent[high].compare_exchange_strong(high, low, std::memory_order_acq_rel)) {
+								break;
+							}
+							a = find(high);
+							b = find(low);
+						}
+					}
+				}
+			}
+		};
+		devRunThreads(threads, work);
+		// Every root is the first slot of its component, so labelling the roots in slot order matches weakComponents.
+		component.resize(size);
+		uint32_t total = 0;
+		for (uint32_t i=0; i < size; i++) {
+			const uint32_t root = find(i);
+			component[i] = (root == i) ? total++ : component[root];
+		}
+		return total;
+	}
+#endif
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Labels the strongly connected components of the Graph, in which two nodes are joined if each can be reached from
+	 *  	the other, using an iterative form of Tarjan's algorithm over the outgoing connections in O(V + E) time.
+	 * @param [out] component
+	 *  	Overwritten with the component of each node by slot (see findSlot). Components are numbered from zero in reverse
+	 *  	topological order: every connection between two components leads from a higher number to a lower one.
+	 * @return
+	 *  	The number of strongly connected components.
+	 ********/
+	uint32_t strongComponents(std::vector<uint32_t>& component) {
+		const uint32_t unseen = -1;
+		component.assign(this->count, unseen);
+		std::vector<uint32_t> order(this->count, unseen), low(this->count), stack;
+		std::vector<c_DfsFrame<NodeData>> frames;
+		uint32_t counter = 0, total = 0;
+		for (uint32_t root=0; root < this->count; root++) {
+			if (order[root] != unseen) {
+				continue;
+			}
+			frames.clear();
+			frames.push_back({this->raw_ptrs[root], 0, true});
+			order[root] = low[root] = counter++;
+			stack.push_back(root);
+			while (!frames.empty()) {
+				c_GraphNode<NodeData>* node = frames.back().node;
+				const uint32_t slot = node->slot;
+				if (frames.back().cursor < node->cnt_out.size()) {
+					c_GraphNode<NodeData>* other = node->cnt_out[frames.back().cursor++];
+					const uint32_t next = other->slot;
+					if (order[next] == unseen) {
+						order[next] = low[next] = counter++;
+						stack.push_back(next);
+						frames.push_back({other, 0, true});
+					} else if ((component[next] == unseen) && (order[next] < low[slot])) {
+						low[slot] = order[next];
+					}
+					continue;
+				}
+				frames.pop_back();
+				if (low[slot] == order[slot]) {
+					uint32_t member;
+					do {
+						member = stack.back();
+						stack.pop_back();
+						component[member] = total;
+					} while (member != slot);
+					total++;
+				}
+				if (!frames.empty()) {
+					const uint32_t above = frames.back().node->slot;
+					if (low[slot] < low[above]) {
+						low[above] = low[slot];
+					}
+				}
+			}
+		}
+		return total;
+	}
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Sorts the nodes of the Graph topologically with Kahn's algorithm, such that every node comes before the targets
+	 *  	of its outgoing connections. Nodes without incoming connections are taken in slot order, in O(V + E) time.
+	 * @param [out] output
+	 *  	Overwritten with the sorted nodes. If the Graph has a cycle, it only holds the nodes that could be sorted, which
+	 *  	excludes every node on (or reachable from) a cycle.
+	 * @return
+	 *  	Returns TRUE if every node was sorted, or FALSE if the Graph has a cycle.
+	 ********/
+	bool topologicalSort(std::vector<c_GraphNode<NodeData>*>& output) {
+		std::vector<uint32_t> pending(this->count, 0);
+		for (uint32_t i=0; i < this->count; i++) {
+			for (const c_GraphNode<NodeData>* other : this->raw_ptrs[i]->cnt_out) {
+				pending[other->slot]++;
+			}
+		}
+		output.clear();
+		output.reserve(this->count);
+		for (uint32_t i=0; i < this->count; i++) {
+			if (pending[i] == 0) {
+				output.push_back(this->raw_ptrs[i]);
+			}
+		}
+		// The output doubles as the queue of nodes whose incoming connections have all been sorted.
+		for (uint32_t head=0; head < output.size(); head++) {
+			for (c_GraphNode<NodeData>* other : output[head]->cnt_out) {
+				if (--pending[other->slot] == 0) {
+					output.push_back(other);
+				}
+			}
+		}
+		return output.size() == this->count;
+	}
 };
 
 }
@@ -0,0 +1,392 @@
+#ifndef ERC_GRAPHFILE
+#define ERC_GRAPHFILE
+
+#include "Graph.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+
+// Files are memory-mapped where POSIX mmap is available, and read into memory otherwise (or if ERC_GRAPHFILE_NO_MMAP is
+// defined before including this header).
+#if (defined(__unix__) || defined(__APPLE__)) && !defined(ERC_GRAPHFILE_NO_MMAP)
+#define ERC_GRAPHFILE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace GraphStruct {
+/********!
+ * @class c_GraphFileHeader
+ *
+ * @brief
+ * Fixed-size header at the start of a graph file. It is followed by the sections of the frozen graph, each starting on a
+ * 64-byte boundary at the offset recorded here (or zero if the section is absent), in the host's byte order:
+ *  	ids[nodes], offsets[nodes + 1], targets[edges], priorities[edges], in_offsets[nodes + 1], in_sources[edges],
+ *  	index_table[index_size], index_keys[index_size], values[nodes]
+ *
+ * @date
+ * 14 October 2026
+ ********/
+struct c_GraphFileHeader {
+	char magic[8];
+	uint32_t version, byte_order;
+	uint32_t flags, nodes, edges, data_size, index_size, reserved;
+	uint64_t sections[9];
+	uint64_t file_size;
+
+	static constexpr uint32_t current_version = 1, native_order = 0x01020304;
+	//! Bits of @c flags.
+	static constexpr uint32_t has_priorities = 1, has_inbound = 2, has_values = 4, index_hashed = 8;
+	//! Positions within @c sections.
+	enum : uint32_t { s_ids, s_offsets, s_targets, s_priorities, s_in_offsets, s_in_sources, s_index_table, s_index_keys, s_values };
+};
+static_assert(sizeof(c_GraphFileHeader) <= 128, "The graph file header must fit in its 128 reserved bytes.");
+
+/********!
+ * @class c_GraphFile
+ *
+ * @brief
+ * A graph loaded from (or saved to) a compact binary file, which holds the frozen (CSR) form of a graph: its node indexes,
+ * its outbound connections with their priorities, optionally its inbound connections, the arrays of its index (ID) to slot
+ * mapping, and, for trivially copyable types, the value of every node. Loading maps the file into memory and points the
+ * frozen graph's arrays straight at it, so the graph can be traversed as soon as open() returns, with no per-node
+ * allocation or parsing. A mutable c_Graph with actual nodes is only built when it is first asked for.
+ *
+ * @date
+ * 14 October 2026
+ *
+ * @note
+ * The files are written in the host's byte order and are rejected on hosts of the other order. Before a file is used,
+ * open() makes one pass over its arrays to check that the connections and the ID index only ever lead to its nodes, so a
+ * truncated or corrupted file is rejected rather than traversed. The node values are taken as they are.
+ ********/
+template<typename NodeData> class c_GraphFile {
+	static_assert(alignof(NodeData) <= 64, "Node values are stored on 64-byte boundaries.");
+	c_GraphCSR<NodeData> csr;
+	const NodeData* values = nullptr;
+	const unsigned char* bytes = nullptr;
+	uint64_t size = 0;
+	bool mapped = false;
+	c_Graph<NodeData>* graph = nullptr; // Built on demand by mutableGraph().
+
+	static uint64_t alignSection(uint64_t offset) noexcept {
+		return (offset + 63) & ~(uint64_t)(63);
+	}
+	// Returns TRUE if the section recorded in the header lies inside the file, after the header, and is suitably aligned.
+	bool validSection(const c_GraphFileHeader& header, uint32_t which, uint64_t length) const noexcept {
+		const uint64_t offset = header.sections[which];
+		return (offset >= sizeof(c_GraphFileHeader)) && ((offset & 63) == 0) && (offset <= this->size) && (length <= this->size - offset);
+	}
+	template<typename T> const T* section(const c_GraphFileHeader& header, uint32_t which) const noexcept {
+		return reinterpret_cast<const T*>(this->bytes + header.sections[which]);
+	}
+	// Returns TRUE if the offsets start at zero, never decrease and end at the number of connections, and every connection
+	// leads to one of the nodes.
+	static bool validAdjacency(const uint32_t* offsets, const uint32_t* slots, uint32_t nodes, uint32_t edges) noexcept {
+		if ((offsets[0] != 0) || (offsets[nodes] != edges)) {
+			return false;
+		}
+		for (uint32_t i=0; i < nodes; i++) {
+			if (offsets[i] > offsets[i + 1]) {
+				return false;
+			}
+		}
+		for (uint32_t e=0; e < edges; e++) {
+			if (slots[e] >= nodes) {
+				return false;
+			}
+		}
+		return true;
+	}
+	// Returns TRUE if the ID index only holds slots of nodes, every lookup through it ends, and the ID of every node leads
+	// back to its own slot (which also rules out repeated IDs).
+	bool validIndex(const c_GraphFileHeader& header) const noexcept {
+		const uint32_t* table = this->section<uint32_t>(header, c_GraphFileHeader::s_index_table);
+		const bool hashed = (header.flags & c_GraphFileHeader::index_hashed) != 0;
+		const uint32_t* keys = hashed ? this->section<uint32_t>(header, c_GraphFileHeader::s_index_keys) : nullptr;
+		const uint32_t size = header.index_size;
+		uint32_t empty = 0;
+		for (uint32_t i=0; i < size; i++) {
+			if (table[i] == (uint32_t)(-1)) {
+				empty++;
+			} else if (table[i] >= header.nodes) {
+				return false;
+			}
+		}
+		// Probing a hashed index wraps around by masking, and only stops at an empty entry.
+		if (hashed && ((size == 0) || ((size & (size - 1)) != 0) || (empty == 0))) {
+			return false;
+		}
+		const uint32_t* ids = this->section<uint32_t>(header, c_GraphFileHeader::s_ids);
+		for (uint32_t i=0; i < header.nodes; i++) {
+			if (c_IdIndex::lookup(table, keys, size, hashed, ids[i]) != i) {
+				return false;
+			}
+		}
+		return true;
+	}
+	// Writes the elements at the next 64-byte boundary, recording where they went. Returns FALSE if writing failed.
+	static bool writeSection(std::FILE* file, uint64_t& position, uint64_t& recorded, const void* data, uint64_t length) {
+		static const unsigned char padding[64] = {};
+		const uint64_t start = alignSection(position);
+		if ((start != position) && (std::fwrite(padding, 1, start - position, file) != start - position)) {
+			return false;
+		}
+		recorded = start;
+		position = start + length;
+		return (length == 0) || (std::fwrite(data, 1, length, file) == length);
+	}
+public:
+	c_GraphFile() = default;
+	c_GraphFile(const c_GraphFile&) = delete;
+	c_GraphFile& operator=(const c_GraphFile&) = delete;
+	~c_GraphFile() {
+		this->close();
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Opens a graph file, mapping it into memory (or reading it, where mapping is unavailable) and pointing the frozen
+	 *  	graph at its contents. Any previously opened file is closed first.
+	 * @param [in] path
+	 *  	The path of the file to open.
+	 * @return
+	 *  	Returns TRUE if the file could be opened, its header is valid for this type of graph, every section lies within
+	 *  	the file, and its connections and ID index are consistent with its nodes.
+	 ********/
+	bool open(const char* path) {
+		this->close();
+#ifdef ERC_GRAPHFILE_MMAP
+		const int fd = ::open(path, O_RDONLY);
+		if (fd < 0) {
+			return false;
+		}
+		struct stat info;
+		if ((::fstat(fd, &info) != 0) || (info.st_size < (off_t)(sizeof(c_GraphFileHeader)))) {
+			::close(fd);
+			return false;
+		}
+		void* address = ::mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		::close(fd);
+		if (address == MAP_FAILED) {
+			return false;
+		}
+		this->bytes = static_cast<const unsigned char*>(address);
+		this->size = info.st_size;
+		this->mapped = true;
+#else
+		std::FILE* file = std::fopen(path, "rb");
+		if (file == nullptr) {
+			return false;
+		}
+		long length = -1;
+		if (std::fseek(file, 0, SEEK_END) == 0) {
+			length = std::ftell(file);
+		}
+		if ((length < (long)(sizeof(c_GraphFileHeader))) || (std::fseek(file, 0, SEEK_SET) != 0)) {
+			std::fclose(file);
+			return false;
+		}
+		unsigned char* buffer = static_cast<unsigned char*>(::operator new(length, std::align_val_t(64)));
+		const bool complete = (std::fread(buffer, 1, length, file) == (std::size_t)(length));
+		std::fclose(file);
+		this->bytes = buffer;
+		this->size = length;
+		if (!complete) {
+			this->close();
+			return false;
+		}
+#endif
+		c_GraphFileHeader header;
+		std::memcpy(&header, this->bytes, sizeof(header));
+		const uint64_t nodes = header.nodes, edges = header.edges;
+		const bool valid = (std::memcmp(header.magic, "ERCGRAPH", 8) == 0) && (header.version == c_GraphFileHeader::current_version)
+			&& (header.byte_order == c_GraphFileHeader::native_order) && (header.file_size == this->size)
+			&& this->validSection(header, c_GraphFileHeader::s_ids, nodes * 4)
+			&& this->validSection(header, c_GraphFileHeader::s_offsets, (nodes + 1) * 4)
+			&& this->validSection(header, c_GraphFileHeader::s_targets, edges * 4)
+			&& (!(header.flags & c_GraphFileHeader::has_priorities) || this->validSection(header, c_GraphFileHeader::s_priorities, edges))
+			&& (!(header.flags & c_GraphFileHeader::has_inbound) || (this->validSection(header, c_GraphFileHeader::s_in_offsets, (nodes + 1) * 4)
+				&& this->validSection(header, c_GraphFileHeader::s_in_sources, edges * 4)))
+			&& this->validSection(header, c_GraphFileHeader::s_index_table, (uint64_t)(header.index_size) * 4)
+			&& (!(header.flags & c_GraphFileHeader::index_hashed) || this->validSection(header, c_GraphFileHeader::s_index_keys, (uint64_t)(header.index_size) * 4))
+			&& (!(header.flags & c_GraphFileHeader::has_values) || ((header.data_size == sizeof(NodeData))
+				&& this->validSection(header, c_GraphFileHeader::s_values, nodes * sizeof(NodeData))))
+			&& validAdjacency(this->section<uint32_t>(header, c_GraphFileHeader::s_offsets), this->section<uint32_t>(header, c_GraphFileHeader::s_targets), header.nodes, header.edges)
+			&& (!(header.flags & c_GraphFileHeader::has_inbound) || validAdjacency(this->section<uint32_t>(header, c_GraphFileHeader::s_in_offsets),
+				this->section<uint32_t>(header, c_GraphFileHeader::s_in_sources), header.nodes, header.edges))
+			&& this->validIndex(header);
+		if (!valid) {
+			this->close();
+			return false;
+		}
+
+		this->csr.ids.view(this->section<uint32_t>(header, c_GraphFileHeader::s_ids), nodes);
+		this->csr.offsets.view(this->section<uint32_t>(header, c_GraphFileHeader::s_offsets), nodes + 1);
+		this->csr.targets.view(this->section<uint32_t>(header, c_GraphFileHeader::s_targets), edges);
+		if (header.flags & c_GraphFileHeader::has_priorities) {
+			this->csr.priorities.view(this->section<uint8_t>(header, c_GraphFileHeader::s_priorities), edges);
+		}
+		if (header.flags & c_GraphFileHeader::has_inbound) {
+			this->csr.in_offsets.view(this->section<uint32_t>(header, c_GraphFileHeader::s_in_offsets), nodes + 1);
+			this->csr.in_sources.view(this->section<uint32_t>(header, c_GraphFileHeader::s_in_sources), edges);
+		}
+		this->csr.index_table.view(this->section<uint32_t>(header, c_GraphFileHeader::s_index_table), header.index_size);
+		this->csr.index_hashed = (header.flags & c_GraphFileHeader::index_hashed) != 0;
+		if (this->csr.index_hashed) {
+			this->csr.index_keys.view(this->section<uint32_t>(header, c_GraphFileHeader::s_index_keys), header.index_size);
+		}
+		if ((header.flags & c_GraphFileHeader::has_values) && std::is_trivially_copyable<NodeData>::value) {
+			this->values = this->section<NodeData>(header, c_GraphFileHeader::s_values);
+		}
+		return true;
+	}
+	//! Closes the file, invalidating the frozen graph and the node values, and destroying the mutable graph if it was built.
+	void close() noexcept {
+		this->csr.clear();
+		this->values = nullptr;
+		if (this->bytes != nullptr) {
+#ifdef ERC_GRAPHFILE_MMAP
+			::munmap(const_cast<unsigned char*>(this->bytes), this->size);
+#else
+			::operator delete(const_cast<unsigned char*>(this->bytes), std::align_val_t(64));
+#endif
+		}
+		this->bytes = nullptr;
+		this->size = 0;
+		this->mapped = false;
+		delete this->graph;
+		this->graph = nullptr;
+	}
+	//! Returns TRUE if a file is open.
+	bool isOpen() const noexcept {
+		return this->bytes != nullptr;
+	}
+	//! Returns TRUE if the open file is memory-mapped rather than read into memory.
+	bool isMapped() const noexcept {
+		return this->mapped;
+	}
+	//! Returns the frozen graph stored in the file, whose arrays point into it (it has no @c nodes).
+	const c_GraphCSR<NodeData>& frozen() const noexcept {
+		return this->csr;
+	}
+	//! Returns the value of each node by slot, or nullptr if the file does not store them.
+	const NodeData* nodeValues() const noexcept {
+		return this->values;
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Returns a mutable graph holding the same nodes and connections as the file, building it on the first call. The
+	 *  	nodes are created in slot order, so they keep their slots, and their connections keep their order.
+	 * @param [in] prefill
+	 *  	The value to give to every node if the file does not store the values.
+	 * @param [in] alloc
+	 *  	How the graph allocates its nodes, if it is built by this call.
+	 * @return
+	 *  	A reference to the graph, which is owned by this object and remains valid until it is closed.
+	 ********/
+	c_Graph<NodeData>& mutableGraph(const NodeData prefill = NodeData(), e_NodeAlloc alloc = e_NodeAlloc::Heap) {
+		if (this->graph != nullptr) {
+			return *this->graph;
+		}
+		this->graph = new c_Graph<NodeData>(alloc);
+		const c_GraphCSR<NodeData>& frozen = this->csr;
+		const uint32_t nodes = frozen.nodeCount();
+		this->graph->addNodes(prefill, frozen.ids.begin(), frozen.ids.end());
+		if (this->values != nullptr) {
+			for (uint32_t i=0; i < nodes; i++) {
+				this->graph->findNode(frozen.ids[i])->nodeData = this->values[i];
+			}
+		}
+		std::vector<c_GraphCnt> connections;
+		connections.reserve(frozen.edgeCount());
+		for (uint32_t i=0; i < nodes; i++) {
+			for (uint32_t e = frozen.offsets[i]; e < frozen.offsets[i + 1]; e++) {
+				const uint8_t priority = frozen.priorities.empty() ? 0 : frozen.priorities[e];
+				connections.push_back({frozen.ids[i], frozen.ids[frozen.targets[e]], priority});
+			}
+		}
+		this->graph->buildEdges(prefill, connections);
+		return *this->graph;
+	}
+
+	/********!
+	 * @date	14 October 2026
+	 * @brief
+	 *  	Writes a frozen graph to a file in the format that open() reads.
+	 * @param [in] path
+	 *  	The path of the file to write, which is replaced if it exists.
+	 * @param [in] frozen
+	 *  	The frozen graph to store, with whichever of its priorities and inbound arrays are present.
+	 * @param [in] nodeValues
+	 *  	If non-null, the value of each node by slot, which is stored for trivially copyable types.
+	 * @return
+	 *  	Returns TRUE if the file was written in full.
+	 ********/
+	static bool save(const char* path, const c_GraphCSR<NodeData>& frozen, const NodeData* nodeValues = nullptr) {
+		const bool withValues = std::is_trivially_copyable<NodeData>::value && (nodeValues != nullptr);
+		c_GraphFileHeader header = {};
+		std::memcpy(header.magic, "ERCGRAPH", 8);
+		header.version = c_GraphFileHeader::current_version;
+		header.byte_order = c_GraphFileHeader::native_order;
+		header.nodes = frozen.nodeCount();
+		header.edges = frozen.edgeCount();
+		header.index_size = frozen.index_table.size();
+		header.flags = (frozen.priorities.empty() ? 0 : c_GraphFileHeader::has_priorities) | (frozen.hasInbound() ? c_GraphFileHeader::has_inbound : 0)
+			| (withValues ? c_GraphFileHeader::has_values : 0) | (frozen.index_hashed ? c_GraphFileHeader::index_hashed : 0);
+		header.data_size = withValues ? sizeof(NodeData) : 0;
+
+		std::FILE* file = std::fopen(path, "wb");
+		if (file == nullptr) {
+			return false;
+		}
+		// Write a placeholder header, then the sections, then go back for the real header once their offsets are known.
+		uint64_t position = 128;
+		bool good = (std::fwrite(&header, 1, sizeof(header), file) == sizeof(header)) && (std::fseek(file, 128, SEEK_SET) == 0);
+		const uint32_t offset_count = (header.nodes == 0) ? 0 : frozen.offsets.size();
+		const uint32_t empty_offset = 0;
+		good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_ids], frozen.ids.data(), (uint64_t)(header.nodes) * 4);
+		good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_offsets], (offset_count != 0) ? frozen.offsets.data() : &empty_offset, (uint64_t)(header.nodes + 1) * 4);
+		good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_targets], frozen.targets.data(), (uint64_t)(header.edges) * 4);
+		if (header.flags & c_GraphFileHeader::has_priorities) {
+			good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_priorities], frozen.priorities.data(), header.edges);
+		}
+		if (header.flags & c_GraphFileHeader::has_inbound) {
+			good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_in_offsets], frozen.in_offsets.data(), (uint64_t)(header.nodes + 1) * 4);
+			good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_in_sources], frozen.in_sources.data(), (uint64_t)(header.edges) * 4);
+		}
+		good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_index_table], frozen.index_table.data(), (uint64_t)(header.index_size) * 4);
+		if (header.flags & c_GraphFileHeader::index_hashed) {
+			good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_index_keys], frozen.index_keys.data(), (uint64_t)(header.index_size) * 4);
+		}
+		if (withValues) {
+			good = good && writeSection(file, position, header.sections[c_GraphFileHeader::s_values], nodeValues, (uint64_t)(header.nodes) * sizeof(NodeData));
+		}
+		header.file_size = position;
+		good = good && (std::fseek(file, 0, SEEK_SET) == 0) && (std::fwrite(&header, 1, sizeof(header), file) == sizeof(header));
+		return (std::fclose(file) == 0) && good;
+	}
+	//! Freezes the graph (with its priorities and inbound arrays) and writes it to a file, along with the value of every
+	//! node for trivially copyable types. Returns TRUE if the file was written in full.
+	static bool save(const char* path, c_Graph<NodeData>& source) {
+		const c_GraphCSR<NodeData>& frozen = source.freeze(true, true);
+		if (!std::is_trivially_copyable<NodeData>::value) {
+			return save(path, frozen);
+		}
+		std::vector<NodeData> nodeValues;
+		nodeValues.reserve(frozen.nodeCount());
+		for (c_GraphNode<NodeData>* i : frozen.nodes) {
+			nodeValues.push_back(i->nodeData);
+		}
+		return save(path, frozen, nodeValues.data());
+	}
+};
+}
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef ERC_PARALLELTHREADS
+#define ERC_PARALLELTHREADS
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// Thread helpers shared by the multi-threaded algorithms of Graph.hpp (ERC_GRAPH_PARALLEL) and BinaryTree.hpp
+// (ERC_BINTREE_PARALLEL), which include this header when they are enabled and bring the helpers into their namespaces.
+
+//! Contains the thread helpers used by the parallel algorithms of the other headers.
+namespace ParallelThreads {
+
+//! Returns the number of threads to use for a parallel algorithm; a request of 0 means one per hardware thread.
+inline uint32_t devParallelThreads(uint32_t requested) noexcept {
+	if (requested != 0) {
+		return requested;
+	}
+	const uint32_t hardware = std::thread::hardware_concurrency();
+	return (hardware != 0) ? hardware : 1;
+}
+
+//! Runs @c work(thread) on the specified number of threads (the calling thread acts as thread 0), and waits for all of them.
+template<typename Work> void devRunThreads(uint32_t threads, Work& work) {
+	std::vector<std::thread> pool;
+	pool.reserve(threads - 1);
+	for (uint32_t t=1; t < threads; t++) {
+		pool.emplace_back([&work, t]() { work(t); });
+	}
+	work(0);
+	for (std::thread& i : pool) {
+		i.join();
+	}
+}
+}
+
+#endif
@@ -0,0 +1,450 @@
+// Microbenchmarks for the graph, binary tree and function hook headers, on synthetic inputs.
+// Build with optimizations, e.g.: g++ -std=c++17 -O2 -I<folder containing AppliedConcepts> benchmark.cpp -o benchmark
+// Run as "benchmark [scale]", where the optional scale (default 1) multiplies the size of every input.
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include "AppliedConcepts/Graph.hpp"
+#include "AppliedConcepts/BinaryTree.hpp"
+#include "AppliedConcepts/FunctionHooksShared.hpp"
+
+// Every allocation made through operator new is counted, so that each benchmark can report its allocations per run.
+static uint64_t allocations = 0;
+void* operator new(std::size_t size) {
+	allocations++;
+	if (void* ptr = std::malloc(size ? size : 1)) {
+		return ptr;
+	}
+	throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept {
+	std::free(ptr);
+}
+void operator delete(void* ptr, std::size_t) noexcept {
+	std::free(ptr);
+}
+
+// Keeps the optimizer from discarding the results of the benchmarked code.
+static volatile uint64_t sink = 0;
+
+/********!
+ * @brief
+ *  	Runs a benchmark several times and prints its fastest run: the time per operation, the rate of connections (for the
+ *  	graph benchmarks), and the allocations made per run.
+ * @param [in] name
+ *  	The label to print for the benchmark.
+ * @param [in] ops
+ *  	The number of operations performed by one run, by which the time is divided.
+ * @param [in] edges
+ *  	The number of connections processed by one run, or zero if the edges per second are not meaningful.
+ * @param [in] code
+ *  	Callable that performs one run, returning a value that depends on all of its work.
+ ********/
+template<typename Code> void bench(const char* name, uint64_t ops, uint64_t edges, Code code) {
+	const uint32_t runs = 5;
+	double best = 1e300;
+	uint64_t allocs = 0;
+	for (uint32_t i=0; i < runs; i++) {
+		const uint64_t before = allocations;
+		const auto start = std::chrono::steady_clock::now();
+		sink = sink + code();
+		const auto stop = std::chrono::steady_clock::now();
+		allocs = allocations - before;
+		const double taken = std::chrono::duration<double, std::nano>(stop - start).count();
+		if (taken < best) best = taken;
+	}
+	std::printf("%-58s %12.2f ns/op", name, best / (ops ? ops : 1));
+	if (edges != 0) {
+		std::printf(" %10.2f Medges/s", (edges * 1e3) / best);
+	} else {
+		std::printf("                 ");
+	}
+	std::printf(" %10.1f allocs/run\n", (double)(allocs));
+}
+
+// Connections between uniformly random pairs of nodes.
+std::vector<GraphStruct::c_GraphCnt> makeRandom(uint32_t nodes, uint32_t edges, std::mt19937& rng) {
+	std::vector<GraphStruct::c_GraphCnt> output;
+	output.reserve(edges);
+	for (uint32_t i=0; i < edges; i++) {
+		output.push_back({(uint32_t)(rng() % nodes) + 1, (uint32_t)(rng() % nodes) + 1, (uint8_t)(rng() % 16)});
+	}
+	return output;
+}
+// Preferential attachment: each new node is linked to 'links' earlier nodes picked in proportion to their degree, with
+// each of those connections pointing one way or the other at random.
+std::vector<GraphStruct::c_GraphCnt> makePowerLaw(uint32_t nodes, uint32_t links, std::mt19937& rng) {
+	std::vector<GraphStruct::c_GraphCnt> output;
+	std::vector<uint32_t> ends = {1};
+	output.reserve((uint64_t)(nodes) * links);
+	for (uint32_t i=2; i <= nodes; i++) {
+		for (uint32_t j=0; j < links; j++) {
+			const uint32_t other = ends[rng() % ends.size()];
+			if (rng() & 1) {
+				output.push_back({i, other, (uint8_t)(rng() % 16)});
+			} else {
+				output.push_back({other, i, (uint8_t)(rng() % 16)});
+			}
+			ends.push_back(other);
+		}
+		ends.push_back(i);
+	}
+	return output;
+}
+// Square grid with connections in both directions between neighbours.
+std::vector<GraphStruct::c_GraphCnt> makeGrid(uint32_t side) {
+	std::vector<GraphStruct::c_GraphCnt> output;
+	for (uint32_t y=0; y < side; y++) {
+		for (uint32_t x=0; x < side; x++) {
+			const uint32_t id = (y * side) + x + 1;
+			if (x + 1 < side) {
+				output.push_back({id, id + 1, 1});
+				output.push_back({id + 1, id, 1});
+			}
+			if (y + 1 < side) {
+				output.push_back({id, id + side, 1});
+				output.push_back({id + side, id, 1});
+			}
+		}
+	}
+	return output;
+}
+
+void benchGraph(const char* label, const std::vector<GraphStruct::c_GraphCnt>& cnts) {
+	using namespace GraphStruct;
+	char name[64];
+	c_Graph<uint32_t> graph(0, cnts.begin(), cnts.end());
+	const uint32_t edges = graph.viewConnections().size();
+	// The rate of the traversals counts the connections leaving the nodes they reach.
+	const uint32_t first = cnts.front().from;
+	uint32_t count = 0, reached = 0;
+	graph.visitBreadthFirst(first, [&count, &reached](c_GraphNode<uint32_t>*, c_GraphNode<uint32_t>* node) {
+		count++;
+		reached += node->externalDegree();
+		return e_Visit::Continue;
+	});
+	std::printf("-- %s: %u connections, %u nodes reached from %u\n", label, edges, count, first);
+
+	std::snprintf(name, sizeof(name), "%s construct", label);
+	bench(name, cnts.size(), cnts.size(), [&cnts]() {
+		c_Graph<uint32_t> built(0, cnts.begin(), cnts.end());
+		return (uint64_t)(built.viewConnections().size());
+	});
+	std::snprintf(name, sizeof(name), "%s construct (arena)", label);
+	bench(name, cnts.size(), cnts.size(), [&cnts]() {
+		c_Graph<uint32_t> built(0, cnts.begin(), cnts.end(), false, e_NodeAlloc::Arena);
+		return (uint64_t)(built.viewConnections().size());
+	});
+	std::snprintf(name, sizeof(name), "%s optimizeCnts", label);
+	bench(name, cnts.size(), cnts.size(), [&cnts]() {
+		c_Graph<uint32_t> built(0, cnts.begin(), cnts.end());
+		return (uint64_t)(built.optimizeCnts());
+	});
+	std::snprintf(name, sizeof(name), "%s runBreadthFirst", label);
+	bench(name, count, reached, [&graph, first]() {
+		return (uint64_t)(graph.runBreadthFirst(first).size());
+	});
+	c_SearchHeader<uint32_t> header;
+	std::snprintf(name, sizeof(name), "%s runBreadthFirst (reused header)", label);
+	bench(name, count, reached, [&graph, &header, first]() {
+		return (uint64_t)(graph.runBreadthFirst(first, &header).size());
+	});
+	std::snprintf(name, sizeof(name), "%s runDepthFirst", label);
+	bench(name, count, reached, [&graph, first]() {
+		return (uint64_t)(graph.runDepthFirst(first).size());
+	});
+	std::snprintf(name, sizeof(name), "%s visitBreadthFirst", label);
+	bench(name, count, reached, [&graph, first]() {
+		uint64_t total = 0;
+		graph.visitBreadthFirst(first, [&total](c_GraphNode<uint32_t>*, c_GraphNode<uint32_t>* node) { total += node->index; return e_Visit::Continue; });
+		return total;
+	});
+	const c_GraphCSR<uint32_t>& frozen = graph.freeze();
+	const uint32_t slot = graph.findSlot(first);
+	c_VisitStamps stamps;
+	std::snprintf(name, sizeof(name), "%s frozen traverseBfs", label);
+	bench(name, count, reached, [&frozen, &stamps, slot]() {
+		return (uint64_t)(frozen.traverseBfs(slot, &stamps).size());
+	});
+	std::snprintf(name, sizeof(name), "%s frozen traverseDfs", label);
+	bench(name, count, reached, [&frozen, &stamps, slot]() {
+		return (uint64_t)(frozen.traverseDfs(slot, &stamps).size());
+	});
+	// A batch of queries from 64 starting nodes, timed per query: one runBreadthFirst each, or all of them in one pass.
+	std::vector<uint32_t> starts;
+	for (uint32_t i=0; i < 64; i++) {
+		starts.push_back(cnts[(i * 7919) % cnts.size()].from);
+	}
+	std::vector<uint32_t> distances;
+	std::vector<uint64_t> masks;
+	std::snprintf(name, sizeof(name), "%s 64 x runBreadthFirst", label);
+	bench(name, starts.size(), 0, [&graph, &starts]() {
+		uint64_t total = 0;
+		for (uint32_t i : starts) {
+			total += graph.runBreadthFirst(i).size();
+		}
+		return total;
+	});
+	std::snprintf(name, sizeof(name), "%s runBreadthFirstMulti (64 starts)", label);
+	bench(name, starts.size(), 0, [&graph, &starts, &distances]() {
+		return (uint64_t)(graph.runBreadthFirstMulti(starts, distances));
+	});
+	std::snprintf(name, sizeof(name), "%s runBreadthFirstBits (64 starts)", label);
+	bench(name, starts.size(), 0, [&graph, &starts, &masks]() {
+		return (uint64_t)(graph.runBreadthFirstBits(starts, masks));
+	});
+	std::snprintf(name, sizeof(name), "%s runBreadthFirstBits (64 starts, distances)", label);
+	bench(name, starts.size(), 0, [&graph, &starts, &masks, &distances]() {
+		return (uint64_t)(graph.runBreadthFirstBits(starts, masks, &distances));
+	});
+}
+
+// A tree where every node only has a right child, which is a linked list in all but name.
+void makeDegenerate(BinTree::c_BinaryTree<uint32_t>& tree, uint32_t nodes) {
+	BinTree::c_BinaryNode<uint32_t>* above = nullptr;
+	for (uint32_t i=1; i <= nodes; i++) {
+		BinTree::c_BinaryNode<uint32_t>* node = new BinTree::c_BinaryNode<uint32_t>(i, i);
+		if (above != nullptr) {
+			above->child_R = node;
+		} else {
+			tree.head = node;
+		}
+		tree.rawData.push_back(node);
+		above = node;
+	}
+	tree.treeHeight = (nodes < 255) ? nodes : 255;
+	tree.rebuildIndex();
+}
+
+void benchTree(const char* label, BinTree::c_BinaryTree<uint32_t>& tree, uint32_t nodes) {
+	using Node = BinTree::c_BinaryNode<uint32_t>;
+	char name[64];
+	std::printf("-- %s: %u nodes\n", label, nodes);
+	std::snprintf(name, sizeof(name), "%s traverseBreadth", label);
+	bench(name, nodes, 0, [&tree]() { return (uint64_t)(tree.traverseBreadth().size()); });
+	std::snprintf(name, sizeof(name), "%s traverseInOrder", label);
+	bench(name, nodes, 0, [&tree]() { return (uint64_t)(tree.traverseInOrder().size()); });
+	std::snprintf(name, sizeof(name), "%s traversePostOrder", label);
+	bench(name, nodes, 0, [&tree]() { return (uint64_t)(tree.traversePostOrder().size()); });
+	std::vector<Node*> scratch; // Handed to the visit* traversals, so that they do not allocate.
+	std::snprintf(name, sizeof(name), "%s visitInOrder", label);
+	bench(name, nodes, 0, [&tree, &scratch]() {
+		uint64_t total = 0;
+		tree.visitInOrder([&total](Node* node) { total += node->index; return true; }, &scratch);
+		return total;
+	});
+	std::snprintf(name, sizeof(name), "%s visitInOrderMorris", label);
+	bench(name, nodes, 0, [&tree]() {
+		uint64_t total = 0;
+		tree.visitInOrderMorris([&total](Node* node) { total += node->index; return true; });
+		return total;
+	});
+	std::snprintf(name, sizeof(name), "%s visitBreadth", label);
+	bench(name, nodes, 0, [&tree, &scratch]() {
+		uint64_t total = 0;
+		tree.visitBreadth([&total](Node* node) { total += node->index; return true; }, &scratch);
+		return total;
+	});
+}
+
+void benchImplicit(const char* label, uint8_t height, BinTree::e_TreeLayout layout) {
+	BinTree::c_ImplicitTree<uint32_t> tree;
+	tree.generateFull(height, 1, layout);
+	const uint32_t nodes = tree.size();
+	char name[64];
+	std::printf("-- %s: %u nodes\n", label, nodes);
+	std::snprintf(name, sizeof(name), "%s visitBreadth", label);
+	bench(name, nodes, 0, [&tree]() {
+		uint64_t total = 0;
+		tree.visitBreadth([&total](uint32_t index, uint32_t& value) { total += index + value; return true; });
+		return total;
+	});
+	std::snprintf(name, sizeof(name), "%s visitInOrder", label);
+	bench(name, nodes, 0, [&tree]() {
+		uint64_t total = 0;
+		tree.visitInOrder([&total](uint32_t index, uint32_t& value) { total += index + value; return true; });
+		return total;
+	});
+	// Root-to-leaf paths towards random leaves, the access pattern the van Emde Boas layout is meant for.
+	std::snprintf(name, sizeof(name), "%s root-to-leaf paths", label);
+	bench(name, 100000, 0, [&tree, height]() {
+		uint64_t total = 0;
+		uint32_t leaf = 12345;
+		for (uint32_t i=0; i < 100000; i++) {
+			leaf = (leaf * 1103515245u) + 12345u;
+			const uint32_t target = (1u << (height - 1)) | (leaf >> (33 - height));
+			total += tree.visitPath([&total, target, height](uint32_t index, uint32_t& value) {
+				total += value;
+				const uint32_t depth = BinTree::c_ImplicitTree<uint32_t>::depthOf(index);
+				if (depth == height) return 0;
+				return ((target >> (height - depth - 1)) & 1) ? 1 : -1;
+			});
+		}
+		return total;
+	});
+}
+
+void benchSearch(uint32_t values, std::mt19937& rng) {
+	std::vector<uint32_t> keys(values);
+	for (uint32_t& i : keys) i = rng();
+	std::printf("-- search tree: %u random keys\n", values);
+	bench("search tree insert", values, 0, [&keys]() {
+		BinTree::c_SearchTree<uint32_t> built;
+		return (uint64_t)(built.insertAll(keys));
+	});
+	BinTree::c_SearchTree<uint32_t> tree;
+	tree.insertAll(keys);
+	bench("search tree find", values, 0, [&tree, &keys]() {
+		uint64_t found = 0;
+		for (uint32_t i : keys) found += tree.contains(i ^ 1);
+		return found;
+	});
+	bench("search tree range scans (64 values)", values / 64, 0, [&tree, &keys, values]() {
+		uint64_t total = 0;
+		for (uint32_t i=0; i < values; i += 64) {
+			uint32_t left = 64;
+			tree.visitRange(keys[i], (uint32_t)(-1), [&total, &left](BinTree::c_BinaryNode<uint32_t>* node) {
+				total += node->nodeData;
+				return --left != 0;
+			});
+		}
+		return total;
+	});
+	bench("search tree erase", values, 0, [&keys]() {
+		BinTree::c_SearchTree<uint32_t> built;
+		built.insertAll(keys);
+		uint64_t erased = 0;
+		for (uint32_t i : keys) erased += built.erase(i);
+		return erased;
+	});
+}
+
+int HookedFunction(int A, int B) {
+	return A + B;
+}
+struct StaticPassHook {
+	template<typename Next> static int hook(const Next& next, int A, int B) {
+		return next.invoke(A, B + 1);
+	}
+};
+
+int SharedPassHook(c_FuncHook_Shared<int, int, int>::c_Context next, int A, int B) {
+	return next.invoke(A, B + 1);
+}
+int PassHook(c_FuncHook_Typed<int, int, int>* const orig, int A, int B) {
+	return orig->invoke(A, B + 1);
+}
+
+uint64_t PayloadFunction(std::vector<uint32_t> values) {
+	return values.size();
+}
+uint64_t PayloadHook(c_FuncHook_Typed<uint64_t, std::vector<uint32_t>>* const orig, std::vector<uint32_t> values) {
+	return orig->invoke(values);
+}
+uint64_t ForwardPayloadHook(c_FuncHook_Forward<uint64_t, std::vector<uint32_t>>::c_Context next, std::vector<uint32_t>&& values) {
+	return next.invoke(std::move(values));
+}
+
+void benchHooks(uint32_t calls) {
+	std::printf("-- c_FuncHook_Typed::call\n");
+	for (uint32_t hooks : {0, 1, 8, 64}) {
+		c_FuncHook_Typed<int, int, int> handler(HookedFunction);
+		c_FuncHook_Shared<int, int, int> shared(HookedFunction);
+		for (uint32_t i=0; i < hooks; i++) {
+			handler.addHook(PassHook);
+			shared.addHook(SharedPassHook);
+		}
+		char name[64];
+		std::snprintf(name, sizeof(name), "call with %u hooks", hooks);
+		bench(name, calls, 0, [&handler, calls]() {
+			uint64_t total = 0;
+			for (uint32_t i=0; i < calls; i++) {
+				total += handler.call(i, 1);
+			}
+			return total;
+		});
+		std::snprintf(name, sizeof(name), "c_FuncHook_Shared::call with %u hooks", hooks);
+		bench(name, calls, 0, [&shared, calls]() {
+			uint64_t total = 0;
+			for (uint32_t i=0; i < calls; i++) {
+				total += shared.call(i, 1);
+			}
+			return total;
+		});
+	}
+	using Chain = c_FuncHook_Static<HookedFunction, StaticPassHook, StaticPassHook, StaticPassHook, StaticPassHook,
+		StaticPassHook, StaticPassHook, StaticPassHook, StaticPassHook>;
+	bench("c_FuncHook_Static::call with 8 hooks", calls, 0, [calls]() {
+		uint64_t total = 0;
+		for (uint32_t i=0; i < calls; i++) {
+			total += Chain::call(i, 1);
+		}
+		return total;
+	});
+
+	// A 1 KB argument through 8 hooks, which the by-value hooks copy at every level.
+	const std::vector<uint32_t> payload(256, 1);
+	c_FuncHook_Typed<uint64_t, std::vector<uint32_t>> copying(PayloadFunction);
+	c_FuncHook_Forward<uint64_t, std::vector<uint32_t>> forwarding(PayloadFunction);
+	for (uint32_t i=0; i < 8; i++) {
+		copying.addHook(PayloadHook);
+		forwarding.addHook(ForwardPayloadHook);
+	}
+	bench("call with a 1 KB argument and 8 hooks", calls / 10, 0, [&copying, &payload, calls]() {
+		uint64_t total = 0;
+		for (uint32_t i=0; i < calls / 10; i++) {
+			total += copying.call(payload);
+		}
+		return total;
+	});
+	bench("c_FuncHook_Forward::call with a 1 KB argument and 8 hooks", calls / 10, 0, [&forwarding, &payload, calls]() {
+		uint64_t total = 0;
+		for (uint32_t i=0; i < calls / 10; i++) {
+			total += forwarding.call(payload);
+		}
+		return total;
+	});
+}
+
+int main(int argc, char** argv) {
+	const uint32_t scale = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 1;
+	std::mt19937 rng(2026);
+
+	benchGraph("random", makeRandom(100000 * scale, 400000 * scale, rng));
+	benchGraph("power-law", makePowerLaw(100000 * scale, 4, rng));
+	benchGraph("grid", makeGrid(300 * scale));
+
+	BinTree::c_BinaryTree<uint32_t> full, degenerate;
+	uint8_t height = 18;
+	for (uint32_t i=scale; i > 1; i >>= 1) height++;
+	const uint32_t full_size = (1u << height) - 1;
+	bench("full tree generateFull", full_size, 0, [height]() {
+		BinTree::c_BinaryTree<uint32_t> built;
+		built.generateFull(height, 0);
+		return (uint64_t)(built.rawData.size());
+	});
+	bench("full tree insertNode", full_size, 0, [full_size]() {
+		BinTree::c_BinaryTree<uint32_t> built;
+		for (uint32_t i=0; i < full_size; i++) {
+			built.insertNode(i);
+		}
+		return (uint64_t)(built.rawData.size());
+	});
+	bench("full tree insertNodes", full_size, 0, [full_size]() {
+		std::vector<uint32_t> values(full_size, 0);
+		BinTree::c_BinaryTree<uint32_t> built;
+		return (uint64_t)(built.insertNodes(values));
+	});
+	full.generateFull(height, 0);
+	benchTree("full tree", full, full_size);
+	makeDegenerate(degenerate, 4096);
+	benchTree("degenerate tree", degenerate, 4096);
+	benchImplicit("implicit tree (Eytzinger)", height + 4, BinTree::e_TreeLayout::Eytzinger);
+	benchImplicit("implicit tree (van Emde Boas)", height + 4, BinTree::e_TreeLayout::VanEmdeBoas);
+	benchSearch(200000 * scale, rng);
+
+	benchHooks(1000000 * scale);
+	return 0;
+}
@@ -0,0 +1,74 @@
+#define ERC_BINTREE_PARALLEL
+#include <iostream>
+#include "./AppliedConcepts/BinaryTree.hpp"
+
+// Build with -pthread. Checks the multi-threaded generation, traversals and reductions against the single-threaded ones.
+
+// A hash of a sequence of indexes, which can be combined in order from the hashes of its parts; combining is associative
+// but not commutative, so a reduction only matches the sequential one if it keeps the parts in order.
+struct c_SequenceHash {
+	uint64_t hash;
+	uint64_t power;
+};
+
+// Compares every parallel traversal and reduction of a tree with the sequential ones, and returns the number of failed checks.
+uint32_t checkTree(const BinTree::c_BinaryTree<int>& tree, uint32_t threads) {
+	const bool inorder = tree.traverseInOrder() == tree.traverseParallel(BinTree::e_TreeOrder::InOrder, threads);
+	const bool revorder = tree.traverseRevOrder() == tree.traverseParallel(BinTree::e_TreeOrder::RevOrder, threads);
+	const bool preorder = tree.traversePreOrder() == tree.traverseParallel(BinTree::e_TreeOrder::PreOrder, threads);
+	const bool postorder = tree.traversePostOrder() == tree.traverseParallel(BinTree::e_TreeOrder::PostOrder, threads);
+
+	const uint64_t base = 1000003;
+	c_SequenceHash expected = {0, 1};
+	for (BinTree::c_BinaryNode<int>* i : tree.traversePreOrder()) {
+		expected = {(expected.hash * base) + i->index, expected.power * base};
+	}
+	const c_SequenceHash reduced = tree.reduceParallel<c_SequenceHash>({0, 1},
+		[base](BinTree::c_BinaryNode<int>* node) { return c_SequenceHash{node->index, base}; },
+		[](c_SequenceHash a, c_SequenceHash b) { return c_SequenceHash{(a.hash * b.power) + b.hash, a.power * b.power}; }, threads);
+	const bool ordered = (reduced.hash == expected.hash) && (reduced.power == expected.power);
+	const bool all = tree.reduceParallel<bool>(true, [](BinTree::c_BinaryNode<int>* node) { return node->nodeData >= 0; },
+		[](bool a, bool b) { return a && b; }, threads);
+	return !inorder + !revorder + !preorder + !postorder + !ordered + !all;
+}
+
+int main() {
+	uint32_t failures = 0;
+	for (uint32_t threads : {0, 1, 2, 7}) {
+		uint32_t generated = 0, traversed = 0;
+		for (uint8_t height : {0, 1, 3, 10, 15}) {
+			// The parallel generation builds the same tree as generateFull, with its stats and index lookups ready.
+			BinTree::c_BinaryTree<int> reference, tree;
+			reference.generateFull(height, 3);
+			reference.setStatCaching(true);
+			tree.generateFullParallel(height, 3, threads);
+			bool same = (tree.rawData.size() == reference.rawData.size()) && (tree.treeHeight == height)
+				&& ((tree.head == nullptr) == (height == 0));
+			for (uint32_t i=0; same && (i < tree.rawData.size()); i++) {
+				const BinTree::c_BinaryNode<int>* a = tree.rawData[i], *b = reference.rawData[i];
+				same = (a->index == b->index) && (a->nodeData == 3) && (tree.findNode(i + 1) == a)
+					&& (a->subtreeSize == b->subtreeSize) && (a->subtreeHeight == b->subtreeHeight)
+					&& ((a->child_L == nullptr) == (b->child_L == nullptr)) && ((a->child_R == nullptr) == (b->child_R == nullptr));
+			}
+			generated += !same;
+			traversed += checkTree(tree, threads);
+		}
+		// Trees that are not full: an incomplete last level, and a chain that cannot be split evenly.
+		BinTree::c_BinaryTree<int> partial, chain;
+		for (int i=0; i < 1000; i++) {
+			partial.insertNode(i);
+		}
+		traversed += checkTree(partial, threads);
+		BinTree::c_BinaryNode<int>* below = nullptr;
+		for (uint32_t i=300; i > 0; i--) {
+			below = (i & 1) ? new BinTree::c_BinaryNode<int>(i, i, below, nullptr) : new BinTree::c_BinaryNode<int>(i, i, nullptr, below);
+		}
+		chain.head = below;
+		traversed += checkTree(chain, threads);
+		std::cout << "On " << threads << " threads: generation " << (generated ? "DIFFERS" : "matches") << ", traversals and reductions "
+			<< (traversed ? "DIFFER" : "match") << '\n';
+		failures += generated + traversed;
+	}
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
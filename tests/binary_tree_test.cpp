@@ -0,0 +1,511 @@
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+#include "./AppliedConcepts/BinaryTree.hpp"
+
+// Prints the outcome of one check, and returns 1 if it failed.
+uint32_t report(const char* what, bool passed) {
+	std::cout << what << ": " << (passed ? "ok" : "FAILED") << '\n';
+	return !passed;
+}
+
+// Returns the indexes of a list of nodes, in order.
+std::vector<uint32_t> indexesOf(const std::vector<BinTree::c_BinaryNode<int>*>& nodes) {
+	std::vector<uint32_t> output;
+	for (BinTree::c_BinaryNode<int>* i : nodes) {
+		output.push_back(i->index);
+	}
+	return output;
+}
+
+// The implicit tree numbers its nodes as c_BinaryTree::generateFull does, so in either layout its traversals must visit
+// the same indexes in the same order as those of a full pointer-based tree.
+uint32_t testImplicitTree() {
+	uint32_t failures = 0;
+	for (BinTree::e_TreeLayout layout : {BinTree::e_TreeLayout::Eytzinger, BinTree::e_TreeLayout::VanEmdeBoas}) {
+		const char* name = (layout == BinTree::e_TreeLayout::Eytzinger) ? "Eytzinger" : "van Emde Boas";
+		bool positions = true, breadth = true, inorder = true, revorder = true, preorder = true, postorder = true, search = true;
+		for (uint8_t height : {1, 2, 5, 10}) {
+			BinTree::c_BinaryTree<int> reference;
+			reference.generateFull(height, 0);
+			BinTree::c_ImplicitTree<int> tree;
+			tree.generateFull(height, 0, layout);
+			// Every index has a position of its own within the storage.
+			std::vector<bool> used(tree.size(), false);
+			for (uint32_t i=1; i <= tree.size(); i++) {
+				const uint32_t at = tree.position(i);
+				positions = positions && (at < tree.size()) && !used[at];
+				if (at < tree.size()) used[at] = true;
+			}
+			std::vector<uint32_t> order;
+			auto collect = [&order](uint32_t index, int&) { order.push_back(index); return true; };
+			tree.visitBreadth(collect);
+			breadth = breadth && (order == indexesOf(reference.traverseBreadth()));
+			order.clear();
+			tree.visitInOrder(collect);
+			inorder = inorder && (order == indexesOf(reference.traverseInOrder()));
+			order.clear();
+			tree.visitRevOrder(collect);
+			revorder = revorder && (order == indexesOf(reference.traverseRevOrder()));
+			order.clear();
+			tree.visitPreOrder(collect);
+			preorder = preorder && (order == indexesOf(reference.traversePreOrder()));
+			order.clear();
+			tree.visitPostOrder(collect);
+			postorder = postorder && (order == indexesOf(reference.traversePostOrder()));
+			// Numbering the values in order makes the tree a search tree, so following a path finds any value.
+			int rank = 0;
+			tree.visitInOrder([&rank](uint32_t, int& value) { value = rank++; return true; });
+			for (int key=0; key < rank; key++) {
+				const uint32_t found = tree.visitPath([key](uint32_t, int& value) { return (key < value) ? -1 : ((key > value) ? 1 : 0); });
+				search = search && tree.contains(found) && (tree.at(found) == key);
+			}
+		}
+		std::cout << "-- Implicit tree, " << name << " layout\n";
+		failures += report("Positions are distinct", positions);
+		failures += report("Level order matches", breadth);
+		failures += report("In order matches", inorder);
+		failures += report("Reverse order matches", revorder);
+		failures += report("Pre order matches", preorder);
+		failures += report("Post order matches", postorder);
+		failures += report("Paths find every value", search);
+	}
+	BinTree::c_ImplicitTree<int> empty;
+	empty.generateFull(0, 1);
+	failures += report("Empty implicit tree has no path", empty.visitPath([](uint32_t, int&) { return 0; }) == 0);
+	return failures;
+}
+
+// A node of the model that the lookup tests keep next to the tree: the index and value at one position of rawData.
+struct c_ModelNode {
+	uint32_t index;
+	int value;
+};
+
+// Checks that the tree holds exactly the model's nodes in level order, and that every index is found at its position.
+bool matchesModel(const BinTree::c_BinaryTree<int>& tree, const std::vector<c_ModelNode>& model) {
+	const std::vector<BinTree::c_BinaryNode<int>*> order = tree.traverseBreadth();
+	if ((order.size() != model.size()) || (tree.rawData.size() != model.size()) || (tree.indexMap.size() != model.size())) {
+		return false;
+	}
+	for (uint32_t i=0; i < model.size(); i++) {
+		if ((order[i] != tree.rawData[i]) || (order[i]->index != model[i].index) || (order[i]->nodeData != model[i].value)) {
+			return false;
+		}
+	}
+	for (uint32_t i=model.size(); i-- > 0;) {
+		// With repeated indexes, the lookups give the first position holding one.
+		uint32_t first = i;
+		for (uint32_t j=0; j < i; j++) {
+			if (model[j].index == model[i].index) {
+				first = j;
+				break;
+			}
+		}
+		if ((tree.findPosition(model[i].index) != first) || (tree.findNode(model[i].index) != tree.rawData[first])) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// Replaces, renames, deletes and inserts nodes at random, through the index lookups, and checks the tree against a plain
+// model of its level order after every operation.
+uint32_t testIndexLookups() {
+	uint32_t failures = 0;
+	std::mt19937 rng(18);
+	bool matches = true, moved = true, missing = true;
+	for (uint8_t height : {1, 3, 6}) {
+		BinTree::c_BinaryTree<int> tree;
+		tree.generateFull(height, 3);
+		std::vector<c_ModelNode> model;
+		for (uint32_t i=1; i < (1u << height); i++) {
+			model.push_back({i, 3});
+		}
+		for (uint32_t step=0; (step < 300) && !model.empty(); step++) {
+			// Mostly indexes that are present, with the odd one that is not.
+			const uint32_t index = (rng() % 4 == 0) ? (rng() % 200) : model[rng() % model.size()].index;
+			uint32_t position = 0;
+			while ((position < model.size()) && (model[position].index != index)) position++;
+			const int value = rng() % 100;
+			switch (rng() % 4) {
+			case 0:
+				tree.replaceNodeData(index, value);
+				if (position < model.size()) model[position].value = value;
+				break;
+			case 1: {
+				const uint32_t renamed = rng() % 200;
+				tree.replaceNodeFull(index, value, renamed);
+				if (position < model.size()) model[position] = {renamed, value};
+				break;
+			}
+			case 2: {
+				// The last node moves into the deleted one's place, and its index is returned.
+				uint32_t expected = 0;
+				if (position < model.size()) {
+					if (position + 1 < model.size()) {
+						model[position] = model.back();
+						expected = model[position].index;
+					}
+					model.pop_back();
+				}
+				moved = moved && (tree.deleteNode(index) == expected);
+				break;
+			}
+			default:
+				model.push_back({model.back().index + 1, value});
+				tree.insertNode(value);
+			}
+			matches = matches && matchesModel(tree, model);
+		}
+		missing = missing && (tree.findNode(1000) == nullptr) && (tree.findPosition(1000) == (uint32_t)(-1));
+	}
+	std::cout << "-- Index lookups\n";
+	failures += report("Tree matches its model", matches);
+	failures += report("Deletions report the moved node", moved);
+	failures += report("Missing indexes are not found", missing);
+	return failures;
+}
+
+// Checks that the tree holds nodes 1 to n in level order, where n is the expected size, with the values given in order.
+bool holdsInOrder(const BinTree::c_BinaryTree<int>& tree, const std::vector<int>& values) {
+	const std::vector<BinTree::c_BinaryNode<int>*> order = tree.traverseBreadth();
+	bool same = (order.size() == values.size()) && (tree.rawData.size() == values.size());
+	for (uint32_t i=0; same && (i < values.size()); i++) {
+		same = (order[i]->index == i + 1) && (order[i]->nodeData == values[i]) && (tree.findNode(i + 1) == order[i]);
+	}
+	return same;
+}
+
+// Fills trees one node at a time and in batches from several kinds of ranges, which must all give the same tree.
+uint32_t testInsertion() {
+	uint32_t failures = 0;
+	bool single = true, vector = true, list = true, stream = true, heights = true;
+	for (uint8_t height : {0, 1, 4, 7}) {
+		std::vector<int> expected((1u << height) - 1, 0);
+		std::vector<int> values;
+		for (int i=0; i < 100; i++) {
+			values.push_back(i * 3);
+			expected.push_back(i * 3);
+		}
+		BinTree::c_BinaryTree<int> one, many, linked, read;
+		one.generateFull(height, 0);
+		many.generateFull(height, 0);
+		linked.generateFull(height, 0);
+		read.generateFull(height, 0);
+		for (int i : values) {
+			one.insertNode(i);
+		}
+		single = single && holdsInOrder(one, expected);
+		vector = vector && (many.insertNodes(values) == values.size()) && holdsInOrder(many, expected);
+		const std::list<int> chain(values.begin(), values.end());
+		list = list && (linked.insertNodes(chain) == values.size()) && holdsInOrder(linked, expected);
+		// Input iterators can only be read once, so their values cannot be counted up front.
+		std::stringstream text;
+		for (int i : values) {
+			text << i << ' ';
+		}
+		stream = stream && (read.insertNodes(std::istream_iterator<int>(text), std::istream_iterator<int>()) == values.size()) && holdsInOrder(read, expected);
+		// The height follows the new levels as they are started.
+		uint32_t levels = 0;
+		for (uint32_t i=expected.size(); i != 0; i >>= 1) levels++;
+		heights = heights && (one.treeHeight == levels) && (many.treeHeight == levels) && (read.treeHeight == levels);
+	}
+	BinTree::c_BinaryTree<int> empty;
+	const bool first = (empty.insertNode(5) == 1) && (empty.head == empty.rawData[0]) && (empty.head->nodeData == 5) && (empty.treeHeight == 1);
+	std::cout << "-- Insertion\n";
+	failures += report("One at a time", single);
+	failures += report("From a vector", vector);
+	failures += report("From a list", list);
+	failures += report("From an input stream", stream);
+	failures += report("Heights follow the levels", heights);
+	failures += report("First node becomes the head", first);
+	return failures;
+}
+
+// Recursively works out the size and height of a subtree, and checks them against the values cached in its nodes.
+bool cachesCorrect(const BinTree::c_BinaryNode<int>* node, uint32_t& size, uint32_t& height) {
+	if (node == nullptr) {
+		size = height = 0;
+		return true;
+	}
+	uint32_t size_L, height_L, size_R, height_R;
+	const bool below = cachesCorrect(node->child_L, size_L, height_L) & cachesCorrect(node->child_R, size_R, height_R);
+	size = 1 + size_L + size_R;
+	height = 1 + std::max(height_L, height_R);
+	return below && (node->subtreeSize == size) && (node->subtreeHeight == height);
+}
+
+// Changes trees at random, with and without the cached stats, and checks calcStats and findInOrder after each change.
+uint32_t testStats() {
+	uint32_t failures = 0;
+	std::mt19937 rng(20);
+	bool counts = true, caches = true, positions = true;
+	for (bool cached : {false, true}) {
+		for (uint8_t height : {0, 3, 6}) {
+			BinTree::c_BinaryTree<int> tree;
+			tree.setStatCaching(cached);
+			tree.generateFull(height, 0);
+			for (int step=0; step < 300; step++) {
+				const uint32_t change = rng() % 3;
+				if ((change == 0) || tree.rawData.empty()) {
+					tree.insertNode(step);
+				} else if (change == 1) {
+					tree.deleteNode(tree.rawData[rng() % tree.rawData.size()]->index);
+				} else {
+					tree.insertNodes({1, 2, 3});
+				}
+				uint32_t size, depth;
+				const bool correct = cachesCorrect(tree.head, size, depth);
+				counts = counts && (tree.calcStats() == size) && (tree.treeHeight == depth);
+				caches = caches && (!cached || correct);
+				const std::vector<BinTree::c_BinaryNode<int>*> order = tree.traverseInOrder();
+				for (uint32_t i=0; i < order.size(); i += 1 + (rng() % 5)) {
+					positions = positions && (tree.findInOrder(i) == order[i]);
+				}
+				positions = positions && (tree.findInOrder(order.size()) == nullptr);
+			}
+		}
+	}
+	// A chain far deeper than the call stack could follow, all to the left, so its first node in order is the last one.
+	BinTree::c_BinaryTree<int> chain;
+	BinTree::c_BinaryNode<int>* above = nullptr;
+	for (uint32_t i=1; i <= 300000; i++) {
+		BinTree::c_BinaryNode<int>* node = new BinTree::c_BinaryNode<int>(i, 0);
+		if (above != nullptr) above->child_L = node;
+		else chain.head = node;
+		chain.rawData.push_back(node);
+		above = node;
+	}
+	const bool deep = (chain.calcStats() == 300000) && (chain.treeHeight == 255);
+	chain.setStatCaching(true);
+	const bool deep_cached = (chain.head->subtreeSize == 300000) && (chain.head->subtreeHeight == 300000) && (chain.calcStats() == 300000) && (chain.findInOrder(0)->index == 300000);
+	std::cout << "-- Stats\n";
+	failures += report("Node counts and heights", counts);
+	failures += report("Cached subtree stats", caches);
+	failures += report("Nodes found by in-order position", positions);
+	failures += report("Deep chain, uncached", deep);
+	failures += report("Deep chain, cached", deep_cached);
+	return failures;
+}
+
+// Recursive references for the traversals, which follow the textbook definitions.
+void referenceInOrder(BinTree::c_BinaryNode<int>* node, bool left, std::vector<BinTree::c_BinaryNode<int>*>& output) {
+	if (node == nullptr) return;
+	referenceInOrder(left ? node->child_L : node->child_R, left, output);
+	output.push_back(node);
+	referenceInOrder(left ? node->child_R : node->child_L, left, output);
+}
+void referencePreOrder(BinTree::c_BinaryNode<int>* node, std::vector<BinTree::c_BinaryNode<int>*>& output) {
+	if (node == nullptr) return;
+	output.push_back(node);
+	referencePreOrder(node->child_L, output);
+	referencePreOrder(node->child_R, output);
+}
+void referencePostOrder(BinTree::c_BinaryNode<int>* node, std::vector<BinTree::c_BinaryNode<int>*>& output) {
+	if (node == nullptr) return;
+	referencePostOrder(node->child_L, output);
+	referencePostOrder(node->child_R, output);
+	output.push_back(node);
+}
+
+// Compares the iterative and Morris traversals with the recursive references on trees of random shapes, and checks that
+// a Morris traversal stopped early leaves the tree as it found it.
+uint32_t testTraversals() {
+	uint32_t failures = 0;
+	std::mt19937 rng(21);
+	bool inorder = true, revorder = true, preorder = true, postorder = true, morris = true, restored = true, stopped = true;
+	for (uint32_t round=0; round < 200; round++) {
+		BinTree::c_BinaryTree<int> tree;
+		const uint32_t count = 1 + (rng() % 60);
+		for (uint32_t i=0; i < count; i++) {
+			tree.rawData.push_back(new BinTree::c_BinaryNode<int>(i + 1, i));
+		}
+		// Hang each node from a free child link of a random earlier one.
+		for (uint32_t i=1; i < count; i++) {
+			while (true) {
+				BinTree::c_BinaryNode<int>* parent = tree.rawData[rng() % i];
+				BinTree::c_BinaryNode<int>*& link = (rng() & 1) ? parent->child_L : parent->child_R;
+				if (link == nullptr) {
+					link = tree.rawData[i];
+					break;
+				}
+			}
+		}
+		tree.head = tree.rawData[0];
+		std::vector<BinTree::c_BinaryNode<int>*> expected, visited;
+		auto collect = [&visited](BinTree::c_BinaryNode<int>* node) { visited.push_back(node); return true; };
+		referenceInOrder(tree.head, true, expected);
+		inorder = inorder && (tree.traverseInOrder() == expected);
+		tree.visitInOrderMorris(collect);
+		morris = morris && (visited == expected);
+		expected.clear();
+		visited.clear();
+		referenceInOrder(tree.head, false, expected);
+		revorder = revorder && (tree.traverseRevOrder() == expected);
+		tree.visitRevOrderMorris(collect);
+		morris = morris && (visited == expected);
+		expected.clear();
+		referencePreOrder(tree.head, expected);
+		preorder = preorder && (tree.traversePreOrder() == expected);
+		expected.clear();
+		referencePostOrder(tree.head, expected);
+		postorder = postorder && (tree.traversePostOrder() == expected);
+		// Stopping partway must still undo the links that the traversal threads through the tree.
+		std::vector<std::pair<BinTree::c_BinaryNode<int>*, BinTree::c_BinaryNode<int>*>> links;
+		for (BinTree::c_BinaryNode<int>* i : tree.rawData) {
+			links.push_back({i->child_L, i->child_R});
+		}
+		const uint32_t limit = rng() % (count + 1);
+		uint32_t seen = 0;
+		const bool finished = tree.visitInOrderMorris([&seen, limit](BinTree::c_BinaryNode<int>*) { return ++seen <= limit; });
+		stopped = stopped && (finished == (limit >= count));
+		seen = 0;
+		tree.visitRevOrderMorris([&seen, limit](BinTree::c_BinaryNode<int>*) { return ++seen <= limit; });
+		for (uint32_t i=0; i < count; i++) {
+			restored = restored && (tree.rawData[i]->child_L == links[i].first) && (tree.rawData[i]->child_R == links[i].second);
+		}
+	}
+	// A zigzag chain far deeper than the call stack could follow, which every traversal (and the destructor) must survive.
+	uint32_t visits = 0;
+	{
+		BinTree::c_BinaryTree<int> chain;
+		BinTree::c_BinaryNode<int>* above = nullptr;
+		for (uint32_t i=1; i <= 1000000; i++) {
+			BinTree::c_BinaryNode<int>* node = new BinTree::c_BinaryNode<int>(i, 0);
+			if (above == nullptr) chain.head = node;
+			else if (i & 1) above->child_L = node;
+			else above->child_R = node;
+			above = node;
+		}
+		auto count = [&visits](BinTree::c_BinaryNode<int>*) { visits++; return true; };
+		chain.visitInOrder(count);
+		chain.visitPreOrder(count);
+		chain.visitPostOrder(count);
+		chain.visitInOrderMorris(count);
+	}
+	std::cout << "-- Traversals\n";
+	failures += report("In order", inorder);
+	failures += report("Reverse order", revorder);
+	failures += report("Pre order", preorder);
+	failures += report("Post order", postorder);
+	failures += report("Morris traversals", morris);
+	failures += report("Morris traversals report stopping", stopped);
+	failures += report("Tree restored after stopping", restored);
+	failures += report("Deep chain", visits == 4000000);
+	return failures;
+}
+
+// Checks that a subtree of a search tree is ordered between the bounds (where given), is balanced, and has the right
+// cached stats. Sets the height of the subtree.
+bool balancedSearch(const BinTree::c_BinaryNode<int>* node, const int* low, const int* high, uint32_t& height) {
+	if (node == nullptr) {
+		height = 0;
+		return true;
+	}
+	uint32_t height_L, height_R;
+	const bool below = balancedSearch(node->child_L, low, &node->nodeData, height_L) & balancedSearch(node->child_R, &node->nodeData, high, height_R);
+	height = 1 + std::max(height_L, height_R);
+	const uint32_t size = 1 + ((node->child_L != nullptr) ? node->child_L->subtreeSize : 0) + ((node->child_R != nullptr) ? node->child_R->subtreeSize : 0);
+	return below && ((low == nullptr) || (*low < node->nodeData)) && ((high == nullptr) || (node->nodeData < *high))
+		&& (std::max(height_L, height_R) - std::min(height_L, height_R) <= 1) && (node->subtreeHeight == height) && (node->subtreeSize == size);
+}
+
+// Orders values from the largest, for the search tree with a custom comparator.
+struct c_Greater {
+	bool operator()(int a, int b) const {
+		return a > b;
+	}
+};
+
+// Inserts and erases values at random in a search tree and in a std::set, and checks that both agree on every query.
+uint32_t testSearchTree() {
+	uint32_t failures = 0;
+	std::mt19937 rng(23);
+	BinTree::c_SearchTree<int> tree;
+	std::set<int> reference;
+	bool changes = true, balanced = true, contents = true, bounds = true, ranks = true, ranges = true;
+	for (uint32_t step=1; step <= 50000; step++) {
+		const int value = rng() % 2000;
+		if (rng() % 3 != 0) {
+			changes = changes && (tree.insert(value) == reference.insert(value).second);
+		} else {
+			changes = changes && (tree.erase(value) == (reference.erase(value) == 1));
+		}
+		if (step % 2500 != 0) continue;
+		uint32_t height;
+		balanced = balanced && balancedSearch(tree.root(), nullptr, nullptr, height) && (tree.height() == height);
+		std::vector<int> values;
+		tree.visitInOrder([&values](BinTree::c_BinaryNode<int>* node) { values.push_back(node->nodeData); return true; });
+		contents = contents && (tree.size() == reference.size()) && std::equal(values.begin(), values.end(), reference.begin(), reference.end());
+		for (uint32_t query=0; query < 100; query++) {
+			const int low = (int)(rng() % 2100) - 50, high = low + (int)(rng() % 200);
+			const std::set<int>::iterator lower = reference.lower_bound(low), upper = reference.upper_bound(low);
+			const BinTree::c_BinaryNode<int>* found_lower = tree.lowerBound(low), *found_upper = tree.upperBound(low);
+			bounds = bounds && ((found_lower == nullptr) ? (lower == reference.end()) : ((lower != reference.end()) && (found_lower->nodeData == *lower)))
+				&& ((found_upper == nullptr) ? (upper == reference.end()) : ((upper != reference.end()) && (found_upper->nodeData == *upper)))
+				&& (tree.contains(low) == (reference.count(low) == 1));
+			const uint32_t position = rng() % (reference.size() + 1);
+			const BinTree::c_BinaryNode<int>* ranked = tree.atRank(position);
+			ranks = ranks && (tree.rank(low) == (uint32_t)(std::distance(reference.begin(), lower)))
+				&& ((position == reference.size()) ? (ranked == nullptr) : ((ranked != nullptr) && (ranked->nodeData == *std::next(reference.begin(), position))));
+			values.clear();
+			tree.visitRange(low, high, [&values](BinTree::c_BinaryNode<int>* node) { values.push_back(node->nodeData); return true; });
+			ranges = ranges && std::equal(values.begin(), values.end(), lower, reference.upper_bound(high));
+		}
+	}
+	// Sorted insertions are the worst case of an unbalanced tree, but an AVL tree stays within 1.44 log2(n) levels.
+	BinTree::c_SearchTree<int> sorted;
+	for (int i=0; i < 100000; i++) {
+		sorted.insert(i);
+	}
+	uint32_t visited = 0;
+	const bool stopped = !sorted.visitRange(10, 1000, [&visited](BinTree::c_BinaryNode<int>*) { return ++visited < 5; }) && (visited == 5);
+	bool erased = true;
+	for (int i=0; i < 100000; i += 2) {
+		erased = erased && sorted.erase(i);
+	}
+	uint32_t height;
+	erased = erased && balancedSearch(sorted.root(), nullptr, nullptr, height) && (sorted.size() == 50000) && (sorted.atRank(0)->nodeData == 1);
+	// Other comparators and types.
+	BinTree::c_SearchTree<int, c_Greater> descending;
+	const bool greater_count = descending.insertAll(std::vector<int>{3, 1, 4, 1, 5, 9, 2, 6}) == 7;
+	const std::vector<BinTree::c_BinaryNode<int>*> order = descending.traverseInOrder();
+	const bool greater = greater_count && (order.front()->nodeData == 9) && (order.back()->nodeData == 1) && (descending.traverseRange(6, 3).size() == 4);
+	BinTree::c_SearchTree<std::string> words;
+	words.insertAll(std::vector<std::string>{"b", "a", "c"});
+	const bool strings = (words.find("a") != nullptr) && (words.find("b")->index == 1) && (words.find("z") == nullptr);
+	words.clear();
+	std::cout << "-- Search tree\n";
+	failures += report("Insertions and erasures match std::set", changes);
+	failures += report("Ordered and balanced", balanced);
+	failures += report("Contents match std::set", contents);
+	failures += report("Lower and upper bounds", bounds);
+	failures += report("Ranks", ranks);
+	failures += report("Ranges", ranges);
+	failures += report("Sorted insertions stay balanced", sorted.height() <= 1.44 * std::log2(100000.0));
+	failures += report("Range visit stops early", stopped);
+	failures += report("Erasures keep the balance", erased);
+	failures += report("Custom comparator", greater);
+	failures += report("String values", strings);
+	failures += report("Cleared tree is empty", words.empty() && (words.size() == 0) && !words.erase("a"));
+	return failures;
+}
+
+int main() {
+	uint32_t failures = 0;
+	failures += testImplicitTree();
+	failures += testIndexLookups();
+	failures += testInsertion();
+	failures += testStats();
+	failures += testTraversals();
+	failures += testSearchTree();
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
@@ -1,5 +1,5 @@
 #include <iostream>
-#include "AppliedConcepts/FunctionHooks.hpp"
+#include "AppliedConcepts/FunctionHooksShared.hpp"
 
 
 int MainFunction(int A, int B) {
@@ -53,10 +53,84 @@ void VoidFunction(int A, char B) {
 }
 c_FuncHook_Void<int, char> VoidFunctionHooks(VoidFunction);
 
+// The same three hooks as a chain that is fixed at compile time.
+struct StaticHook1 {
+	template<typename Next> static int hook(const Next& next, int A, int B) {
+		std::cout << "Static Hook 1 called with " << A << " and " << B << '\n';
+		return next.invoke(A + 2, B);
+	}
+};
+struct StaticHook2 {
+	template<typename Next> static int hook(const Next& next, int A, int B) {
+		std::cout << "Static Hook 2 called with " << A << " and " << B << '\n';
+		if (A == B) {
+			return 7;
+		}
+		return next.invoke(A, 2 * B);
+	}
+};
+struct StaticHook3 {
+	template<typename Next> static int hook(const Next& next, int A, int B) {
+		std::cout << "Static Hook 3 called with " << A << " and " << B << '\n';
+		return next.invoke(A + 1, B + 1);
+	}
+};
+// A shared hook, which keeps its position in the chain in its context, so it can call the function again from inside.
+c_FuncHook_Shared<int, int, int> SharedFunctionHooks(MainFunction);
+int SharedHook(c_FuncHook_Shared<int, int, int>::c_Context next, int A, int B) {
+	std::cout << "Shared Hook called with " << A << " and " << B << '\n';
+	if (A > 1) {
+		return next.invoke(A, B) + SharedFunctionHooks.call(A - 1, B);
+	}
+	return next.invoke(A, B);
+}
+
+using MainFunctionChain = c_FuncHook_Static<MainFunction, StaticHook1, StaticHook2, StaticHook3>;
+
+// A value that counts its copies, for checking that forwarding hooks pass their arguments on without copying them.
+struct Counted {
+	static uint32_t copies;
+	int value;
+	explicit Counted(int initial) : value(initial) {}
+	Counted(const Counted& other) : value(other.value) {
+		copies++;
+	}
+	Counted(Counted&& other) noexcept : value(other.value) {}
+};
+uint32_t Counted::copies = 0;
+int CountedFunction(Counted counted) {
+	return counted.value;
+}
+c_FuncHook_Forward<int, Counted> ForwardFunctionHooks(CountedFunction);
+int ForwardHook(c_FuncHook_Forward<int, Counted>::c_Context next, Counted&& counted) {
+	counted.value++;
+	return next.invoke(std::move(counted));
+}
+
+// A result that can be neither default-constructed, copied nor moved, so it can only be returned as it is made.
+struct Token {
+	const int value;
+	explicit Token(int initial) : value(initial) {}
+	Token(const Token&) = delete;
+	Token& operator=(const Token&) = delete;
+};
+Token TokenFunction(int A) {
+	return Token(A);
+}
+c_FuncHook_Typed<Token, int> TypedTokenHooks(TokenFunction);
+Token TypedTokenHook(c_FuncHook_Typed<Token, int>* const orig, int A) {
+	return orig->invoke(A + 1);
+}
+c_FuncHook_Forward<Token, int> ForwardTokenHooks(TokenFunction);
+Token ForwardTokenHook(c_FuncHook_Forward<Token, int>::c_Context next, int&& A) {
+	return next.invoke(A + 2);
+}
+
 int main() {
 	MainFunctionHooks.addHook(Hook1);
 	MainFunctionHooks.addHook(Hook2);
 	MainFunctionHooks.addHook(Hook3);
+	SharedFunctionHooks.addHook(SharedHook);
 	VoidFunctionHooks.addHook(VHook1);
 	VoidFunctionHooks.addHook(VHook2);
 	VoidFunctionHooks.addHook(VHook3);
@@ -67,5 +141,30 @@ int main() {
 	VoidFunctionHooks.call(10, 'A');
 	VoidFunctionHooks.call(10, 'C');
 	VoidFunctionHooks.call(10, '\n');
-	return 0;
+	std::cout << '\n';
+	output = MainFunctionChain::call(1, 1);
+	std::cout << "Final output from the static hook madness: " << output << '\n';
+	output = MainFunctionChain::call(3, 5);
+	std::cout << "Final output from the static hook madness: " << output << "\n\n";
+	output = SharedFunctionHooks.call(3, 1);
+	std::cout << "Final output from the shared hook: " << output << "\n\n";
+	
+	uint32_t failures = 0;
+	for (uint32_t i=0; i < 8; i++) {
+		ForwardFunctionHooks.addHook(ForwardHook);
+	}
+	output = ForwardFunctionHooks.call(Counted(1));
+	std::cout << "Through 8 forwarding hooks, an rvalue gives " << output << " with " << Counted::copies << " copies (expected 9 with 0)\n";
+	failures += (output != 9) || (Counted::copies != 0);
+	Counted kept(2);
+	output = ForwardFunctionHooks.call(kept);
+	std::cout << "Through 8 forwarding hooks, an lvalue gives " << output << " with " << Counted::copies << " copy, and is left at "
+		<< kept.value << " (expected 10 with 1, left at 2)\n";
+	failures += (output != 10) || (Counted::copies != 1) || (kept.value != 2);
+	TypedTokenHooks.addHook(TypedTokenHook);
+	ForwardTokenHooks.addHook(ForwardTokenHook);
+	const int typed = TypedTokenHooks.call(1).value, forwarded = ForwardTokenHooks.call(1).value;
+	std::cout << "Results without default or copy constructors: " << typed << " and " << forwarded << " (expected 2 and 3)\n";
+	failures += (typed != 2) || (forwarded != 3);
+	return failures ? 1 : 0;
 }
@@ -0,0 +1,116 @@
+#define ERC_FUNCHOOK_PROFILE
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include "./AppliedConcepts/FunctionHooksShared.hpp"
+
+// Build with -pthread. Checks the call counts and times recorded by every kind of hook when ERC_FUNCHOOK_PROFILE is defined.
+
+int MainFunction(int A, int B) {
+	return (2 * A) + B + 1;
+}
+// The second hook returns early on a tie, so the original function is not reached from it.
+int Hook1(c_FuncHook_Typed<int, int, int>* const orig, int A, int B) {
+	return orig->invoke(A + 2, B);
+}
+int Hook2(c_FuncHook_Typed<int, int, int>* const orig, int A, int B) {
+	if (A == B) {
+		return 7;
+	}
+	return orig->invoke(A, 2 * B);
+}
+int Hook3(c_FuncHook_Typed<int, int, int>* const orig, int A, int B) {
+	return orig->invoke(A + 1, B + 1);
+}
+
+int voidTotal = 0;
+void VoidFunction(int A) {
+	voidTotal += A;
+}
+// Skips the rest of the chain for negative values.
+void VHook1(c_FuncHook_Void<int>* const orig, int A) {
+	if (A < 0) {
+		return;
+	}
+	orig->invoke(A + 1);
+}
+void VHook2(c_FuncHook_Void<int>* const orig, int A) {
+	orig->invoke(2 * A);
+}
+
+int SharedHook1(c_FuncHook_Shared<int, int, int>::c_Context next, int A, int B) {
+	return next.invoke(A + 2, B);
+}
+int SharedHook2(c_FuncHook_Shared<int, int, int>::c_Context next, int A, int B) {
+	if (A == B) {
+		return 7;
+	}
+	return next.invoke(A, 2 * B);
+}
+
+// Checks the totals of one chain against the expected calls and short circuits of each hook, and the calls of the original.
+// Every level must spend no more time in itself than in total, and no less time in total than the level it invoked.
+uint32_t checkProfile(const char* name, const c_HookProfile& profile, const std::vector<uint64_t>& calls,
+		const std::vector<uint64_t>& short_circuits, uint64_t original) {
+	bool counts = (profile.hooks.size() == calls.size()) && (profile.original.calls == original) && (profile.original.short_circuits == 0);
+	bool times = profile.original.exclusive_ns <= profile.original.inclusive_ns;
+	for (uint32_t i=0; counts && (i < calls.size()); i++) {
+		const c_HookStats& stats = profile.hooks[i];
+		counts = (stats.calls == calls[i]) && (stats.short_circuits == short_circuits[i]);
+		times = times && (stats.exclusive_ns <= stats.inclusive_ns) && (stats.max_exclusive_ns <= stats.max_inclusive_ns)
+			&& (stats.max_inclusive_ns <= stats.inclusive_ns);
+		if (i + 1 < calls.size()) {
+			times = times && (stats.inclusive_ns >= profile.hooks[i + 1].inclusive_ns);
+		}
+	}
+	std::cout << name << ": counts " << (counts ? "match" : "DIFFER") << ", times " << (times ? "consistent" : "INCONSISTENT") << '\n';
+	return !counts + !times;
+}
+
+int main() {
+	uint32_t failures = 0;
+
+	// (1, 1) runs every hook and the original; (3, 5) stops at the second hook, which short-circuits the first one too.
+	c_FuncHook_Typed<int, int, int> typed(MainFunction);
+	typed.addHook(Hook1);
+	typed.addHook(Hook2);
+	typed.addHook(Hook3);
+	failures += (typed.call(1, 1) != 12) || (typed.call(3, 5) != 7);
+	failures += checkProfile("Typed hooks", typed.profile(), {2, 2, 1}, {1, 1, 0}, 1);
+
+	// Negative values stop at the first hook.
+	c_FuncHook_Void<int> voids(VoidFunction);
+	voids.addHook(VHook1);
+	voids.addHook(VHook2);
+	voids.call(1);
+	voids.call(-1);
+	voids.call(2);
+	failures += voidTotal != 10;
+	failures += checkProfile("Void hooks", voids.profile(), {3, 2}, {1, 0}, 2);
+
+	// Calls from several threads are recorded by each thread apart, and added together.
+	c_FuncHook_Shared<int, int, int> shared(MainFunction);
+	shared.addHook(SharedHook1);
+	shared.addHook(SharedHook2);
+	std::vector<std::thread> pool;
+	std::atomic<uint32_t> wrong(0);
+	for (uint32_t t=0; t < 4; t++) {
+		pool.emplace_back([&shared, &wrong]() {
+			for (uint32_t i=0; i < 100; i++) {
+				wrong += (shared.call(1, 1) != 9) || (shared.call(3, 5) != 7);
+			}
+		});
+	}
+	for (std::thread& i : pool) {
+		i.join();
+	}
+	failures += wrong != 0;
+	failures += checkProfile("Shared hooks on 4 threads", shared.profile(), {800, 800}, {400, 400}, 400);
+
+	// Removing a hook leaves the counts by position, so the remaining hook takes on those of the first.
+	shared.removeHook(SharedHook1);
+	failures += checkProfile("Shared hooks after a removal", shared.profile(), {800}, {400}, 400);
+
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,64 @@
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include "./AppliedConcepts/FunctionHooksShared.hpp"
+
+// Build with -pthread. Checks that shared hooks can be added and removed while other threads are calling through them.
+
+int Identity(int A) {
+	return A;
+}
+c_FuncHook_Shared<int, int> SharedHooks(Identity);
+
+// Each hook adds its own digit, so the result of a call tells which of them were in the list it ran through.
+int AddOne(c_FuncHook_Shared<int, int>::c_Context next, int A) {
+	return next.invoke(A) + 1;
+}
+int AddTen(c_FuncHook_Shared<int, int>::c_Context next, int A) {
+	return next.invoke(A) + 10;
+}
+int AddHundred(c_FuncHook_Shared<int, int>::c_Context next, int A) {
+	return next.invoke(A) + 100;
+}
+
+int main() {
+	uint32_t failures = 0;
+	SharedHooks.addHook(AddOne);
+
+	// The readers only ever see whole versions of the list, which always hold AddOne and at most one of each of the others.
+	std::atomic<bool> writing(true);
+	std::atomic<uint32_t> calls(0), torn(0);
+	std::vector<std::thread> pool;
+	for (uint32_t t=0; t < 4; t++) {
+		pool.emplace_back([&writing, &calls, &torn]() {
+			while (writing) {
+				const int result = SharedHooks.call(1000);
+				torn += (result != 1001) && (result != 1011) && (result != 1101) && (result != 1111);
+				calls++;
+			}
+		});
+	}
+	uint32_t unchanged = 0;
+	for (uint32_t i=0; i < 2000; i++) {
+		unchanged += !SharedHooks.addHook(AddTen);
+		unchanged += !SharedHooks.addHook(AddHundred);
+		unchanged += !SharedHooks.removeHook(AddTen);
+		unchanged += !SharedHooks.removeHook(AddHundred);
+	}
+	writing = false;
+	for (std::thread& i : pool) {
+		i.join();
+	}
+	std::cout << "Changed the hooks 8000 times during " << calls << " calls: " << unchanged << " changes failed and " << torn
+		<< " results were wrong (expected 0 and 0).\n";
+	failures += (unchanged != 0) || (torn != 0);
+	std::cout << "Hooks left: " << SharedHooks.size() << " (expected 1).\n";
+	failures += (SharedHooks.size() != 1) || (SharedHooks.call(0) != 1);
+
+	// Hooks that were never registered are not removed, and the list is left as it was.
+	failures += SharedHooks.removeHook(AddTen) || (SharedHooks.size() != 1);
+	failures += !SharedHooks.removeHook(AddOne) || (SharedHooks.size() != 0) || (SharedHooks.call(5) != 5);
+
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
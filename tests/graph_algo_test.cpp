@@ -37,9 +37,10 @@ int main() {
 	}
 	std::cout << '\n';
 	std::cout << testgraph_maze.optimizeCnts(testPrioFunc) << " connections present.\n";
-	output = testgraph_maze.runBreadthFirst(1);
-	for (GraphStruct::c_GraphNode<uint8_t>* i : output) {
-		std::cout << i->index << ' ';
+	std::vector<uint32_t> levels;
+	output = testgraph_maze.runBreadthFirst(1, levels);
+	for (uint32_t i=0; i < output.size(); i++) {
+		std::cout << output.at(i)->index << '@' << levels.at(i) << ' ';
 	}
 	std::cout << '\n';
 	connects = testgraph_maze.viewConnections();
@@ -47,5 +48,34 @@ int main() {
 		std::cout << i.from << '-' << i.to << ':' << (int)(i.priority) << ' ';
 	}
 	std::cout << '\n';
+	std::vector<GraphStruct::c_GraphNode<uint8_t>*> path;
+	uint64_t length = testgraph_maze.shortestPath(1, 11, &path, GraphStruct::e_PathQueue::Buckets);
+	std::cout << "Shortest path from 1 to 11 has length " << length << ": ";
+	for (GraphStruct::c_GraphNode<uint8_t>* i : path) {
+		std::cout << i->index << ' ';
+	}
+	std::cout << '\n';
+	std::vector<uint32_t> components;
+	std::cout << testgraph_maze.strongComponents(components) << " strongly connected and ";
+	std::cout << testgraph_maze.weakComponents(components) << " weakly connected components; ";
+	std::cout << (testgraph_maze.topologicalSort(path) ? "no cycles.\n" : "has cycles.\n");
+	// Repeated connections keep their own priorities, so the cheaper copy of 1-2 is the one taken.
+	GraphStruct::c_Graph<int> repeated(0, {{1, 2, 5}, {1, 2, 3}, {2, 3, 4}});
+	std::cout << "With repeated connections, 1 to 2 has length " << repeated.shortestPath(1, 2);
+	std::cout << " (expected 3) and 1 to 3 has length " << repeated.shortestPath(1, 3) << " (expected 7).\n";
+	// Without any priorities, every connection weighs 1, so the length counts the connections along the path.
+	GraphStruct::c_Graph<int> unweighted(0, {{1, 2}, {2, 3}, {3, 4}, {1, 5}, {5, 4}});
+	std::cout << "Without priorities, 1 to 4 has length " << unweighted.shortestPath(1, 4) << " (expected 2)";
+	// The same holds for a snapshot made beforehand by freeze(), which asks for the priorities by default.
+	unweighted.freeze();
+	std::cout << " and " << unweighted.shortestPath(1, 4) << " after freeze() (expected 2).\n";
+	// Each traversal keeps its own visited set, so one can be started from inside another's visitor.
+	uint32_t outer = 0, inner = 0;
+	testgraph_maze.visitBreadthFirst(1, [&](GraphStruct::c_GraphNode<uint8_t>*, GraphStruct::c_GraphNode<uint8_t>*) {
+		outer++;
+		inner += testgraph_maze.runDepthFirst(1).size();
+		return GraphStruct::e_Visit::Continue;
+	});
+	std::cout << "Nested traversals visited " << outer << " nodes, each seeing " << (inner / outer) << " (expected the same).\n";
 	return 0;
 }
@@ -0,0 +1,115 @@
+#include <iostream>
+#include <random>
+#include "./AppliedConcepts/Graph.hpp"
+
+// Checks the batched Breadth-First traversals against one runBreadthFirst per initial node.
+
+// Returns the distance of every node by slot from one initial node, found by runBreadthFirst, for a graph of @c slots nodes.
+std::vector<uint32_t> distancesFrom(GraphStruct::c_Graph<int>& graph, uint32_t slots, uint32_t start) {
+	std::vector<uint32_t> distances(slots, GraphStruct::c_BatchSearch::unreached), levels;
+	const std::vector<GraphStruct::c_GraphNode<int>*> output = graph.runBreadthFirst(start, levels);
+	for (uint32_t i=0; i < output.size(); i++) {
+		distances[output[i]->slot] = levels[i];
+	}
+	return distances;
+}
+
+// Runs both batched traversals from a list of initial nodes, and compares them with the per-node distances. Returns the
+// number of failed checks.
+uint32_t checkBatch(GraphStruct::c_Graph<int>& graph, uint32_t slots, const std::vector<uint32_t>& starts) {
+	std::vector<std::vector<uint32_t>> single;
+	for (uint32_t i : starts) {
+		single.push_back(distancesFrom(graph, slots, i));
+	}
+	// The multi-source traversal keeps the nearest initial node of each node, the first listed of any tied.
+	std::vector<uint32_t> distances, nearest;
+	const uint32_t reached = graph.runBreadthFirstMulti(starts, distances, &nearest);
+	bool multi = (distances.size() == slots) && (nearest.size() == slots);
+	uint32_t expected_reached = 0;
+	for (uint32_t s=0; multi && (s < slots); s++) {
+		uint32_t best = GraphStruct::c_BatchSearch::unreached, source = GraphStruct::c_BatchSearch::unreached;
+		for (uint32_t i=0; i < starts.size(); i++) {
+			if (single[i][s] < best) {
+				best = single[i][s];
+				source = i;
+			}
+		}
+		multi = (distances[s] == best) && (nearest[s] == source);
+		expected_reached += best != GraphStruct::c_BatchSearch::unreached;
+	}
+	multi = multi && (reached == expected_reached);
+	// The bit-parallel traversal keeps the distance from every initial node separately.
+	std::vector<uint64_t> words;
+	std::vector<uint32_t> all;
+	const uint32_t any = graph.runBreadthFirstBits(starts, words, &all);
+	bool bits = (words.size() == slots) && (all.size() == (uint64_t)(slots) * starts.size());
+	uint32_t expected_any = 0;
+	for (uint32_t s=0; bits && (s < slots); s++) {
+		uint64_t mask = 0;
+		for (uint32_t i=0; i < starts.size(); i++) {
+			mask |= (uint64_t)(single[i][s] != GraphStruct::c_BatchSearch::unreached) << i;
+			bits = bits && (all[(s * starts.size()) + i] == single[i][s]);
+		}
+		bits = bits && (words[s] == mask);
+		expected_any += mask != 0;
+	}
+	bits = bits && (any == expected_any);
+	return !multi + !bits;
+}
+
+int main() {
+	uint32_t failures = 0;
+	std::mt19937 rng(30);
+	for (uint32_t round=0; round < 40; round++) {
+		// IDs 1 to nodes, some of which may have no connections and so not be in the graph at all.
+		const uint32_t nodes = 2 + (rng() % 150), connections = 1 + (rng() % (3 * nodes));
+		std::vector<GraphStruct::c_GraphCnt> cnts;
+		for (uint32_t i=0; i < connections; i++) {
+			cnts.push_back({1 + (uint32_t)(rng() % nodes), 1 + (uint32_t)(rng() % nodes)});
+		}
+		GraphStruct::c_Graph<int> graph(0, cnts.begin(), cnts.end());
+		auto countSlots = [&graph, nodes]() {
+			uint32_t slots = graph.findSlot(1000) != (uint32_t)(-1);
+			for (uint32_t i=1; i <= nodes; i++) {
+				slots += graph.findSlot(i) != (uint32_t)(-1);
+			}
+			return slots;
+		};
+		const uint32_t slots = countSlots();
+		uint32_t mismatches = 0;
+		for (uint32_t sources : {1, 7, 64}) {
+			// Missing and repeated initial nodes are included on purpose.
+			std::vector<uint32_t> starts;
+			for (uint32_t i=0; i < sources; i++) {
+				starts.push_back(1 + (rng() % (nodes + 3)));
+			}
+			if (sources > 1) starts[1] = starts[0];
+			mismatches += checkBatch(graph, slots, starts);
+		}
+		// New connections (and a new node) must be seen by the next batch, through a fresh snapshot.
+		graph.addEdges(0, {{1, 1000}, {1000, 2}});
+		mismatches += checkBatch(graph, countSlots(), {1000, 2, 1});
+		failures += mismatches;
+		if (mismatches != 0) {
+			std::cout << "Round " << round << " on " << slots << " nodes: " << mismatches << " batched traversals DIFFER\n";
+		}
+	}
+	std::cout << "Random graphs compared with one runBreadthFirst per initial node.\n";
+
+	// Over the limit of the bit-parallel traversal, nothing is run; an empty batch reaches nothing.
+	GraphStruct::c_Graph<int> graph(0, {{1, 2}, {2, 3}});
+	std::vector<uint64_t> words;
+	std::vector<uint32_t> distances;
+	const uint32_t over = graph.runBreadthFirstBits(std::vector<uint32_t>(GraphStruct::c_BatchSearch::max_sources + 1, 1), words, &distances);
+	std::cout << "Over the limit: " << over << " nodes (expected 0).\n";
+	failures += (over != 0) || !words.empty() || !distances.empty();
+	const uint32_t none = graph.runBreadthFirstMulti({}, distances);
+	std::cout << "Empty batch: " << none << " nodes (expected 0).\n";
+	failures += none != 0;
+	for (uint32_t i : distances) {
+		failures += i != GraphStruct::c_BatchSearch::unreached;
+	}
+
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,103 @@
+#include <cstddef>
+#include <cstdio>
+#include <iostream>
+#include "./AppliedConcepts/GraphFile.hpp"
+
+GraphStruct::c_Graph<uint32_t> testgraph_file(7, {
+	{1, 2, 3}, {1, 3, 1},
+	{2, 4, 2}, {2, 1, 1},
+	{3, 4, 5}, {3, 5, 1},
+	{4, 6, 2},
+	{5, 6, 7},
+	{6, 1, 4},
+	{20, 1, 2}
+});
+
+const char* const test_path = "graph_file_test.bin";
+
+// Copies the saved file with one 32-bit word overwritten, and reports whether the damaged copy is rejected.
+bool rejectsDamage(const char* damaged, uint64_t position, uint32_t word) {
+	std::FILE* in = std::fopen(test_path, "rb");
+	std::FILE* out = std::fopen(damaged, "wb");
+	if ((in == nullptr) || (out == nullptr)) {
+		return false;
+	}
+	int ch;
+	for (uint64_t i=0; (ch = std::fgetc(in)) != EOF; i++) {
+		if ((i >= position) && (i < position + 4)) {
+			ch = (word >> (8 * (i - position))) & 0xFF;
+		}
+		std::fputc(ch, out);
+	}
+	std::fclose(in);
+	std::fclose(out);
+	GraphStruct::c_GraphFile<uint32_t> file;
+	const bool rejected = !file.open(damaged);
+	std::remove(damaged);
+	return rejected;
+}
+
+int main() {
+	uint32_t failures = 0;
+	// Give each node a value of its own, so the stored values can be checked too.
+	for (uint32_t i : {1, 2, 3, 4, 5, 6, 20}) {
+		testgraph_file.findNode(i)->nodeData = i * 10;
+	}
+	std::vector<GraphStruct::c_GraphNode<uint32_t>*> original = testgraph_file.runBreadthFirst(20);
+	std::cout << "Saving: " << (GraphStruct::c_GraphFile<uint32_t>::save(test_path, testgraph_file) ? "done" : "FAILED") << '\n';
+
+	GraphStruct::c_GraphFile<uint32_t> file;
+	if (!file.open(test_path)) {
+		std::cout << "Opening the saved file FAILED\n";
+		return 1;
+	}
+	const GraphStruct::c_GraphCSR<uint32_t>& frozen = file.frozen();
+	std::cout << frozen.nodeCount() << " nodes and " << frozen.edgeCount() << " connections loaded (expected 7 and 10).\n";
+	failures += (frozen.nodeCount() != 7) || (frozen.edgeCount() != 10);
+
+	// The frozen graph in the file traverses in the same order as the graph it was saved from.
+	std::vector<uint32_t> slots = frozen.traverseBfs(frozen.findSlot(20));
+	std::cout << "Frozen BFS from 20: ";
+	for (uint32_t i=0; i < slots.size(); i++) {
+		std::cout << frozen.ids[slots[i]] << ' ';
+		failures += (i >= original.size()) || (frozen.ids[slots[i]] != original[i]->index);
+	}
+	std::cout << '\n';
+	failures += slots.size() != original.size();
+
+	// So does the mutable graph rebuilt from it, which also keeps every value and priority.
+	GraphStruct::c_Graph<uint32_t>& rebuilt = file.mutableGraph();
+	std::vector<GraphStruct::c_GraphNode<uint32_t>*> output = rebuilt.runBreadthFirst(20);
+	std::cout << "Rebuilt BFS from 20: ";
+	for (uint32_t i=0; i < output.size(); i++) {
+		std::cout << output[i]->index << '=' << output[i]->nodeData << ' ';
+		failures += (i >= original.size()) || (output[i]->index != original[i]->index) || (output[i]->nodeData != original[i]->nodeData);
+	}
+	std::cout << '\n';
+	failures += output.size() != original.size();
+	std::cout << "Shortest path from 20 to 6 has length " << rebuilt.shortestPath(20, 6) << " (expected " << testgraph_file.shortestPath(20, 6) << ").\n";
+	failures += rebuilt.shortestPath(20, 6) != testgraph_file.shortestPath(20, 6);
+	file.close();
+
+	// Damaged copies are turned away: a connection leading past the last node, offsets that go backwards, and a section
+	// that runs past the end of the file.
+	GraphStruct::c_GraphFileHeader header;
+	std::FILE* in = std::fopen(test_path, "rb");
+	const bool read = (in != nullptr) && (std::fread(&header, 1, sizeof(header), in) == sizeof(header));
+	if (in != nullptr) {
+		std::fclose(in);
+	}
+	if (!read) {
+		std::cout << "Reading the header back FAILED\n";
+		return 1;
+	}
+	const bool target = rejectsDamage("graph_file_test_target.bin", header.sections[GraphStruct::c_GraphFileHeader::s_targets], 7);
+	const bool offsets = rejectsDamage("graph_file_test_offsets.bin", header.sections[GraphStruct::c_GraphFileHeader::s_offsets] + 4, 9);
+	const bool section = rejectsDamage("graph_file_test_section.bin", offsetof(GraphStruct::c_GraphFileHeader, sections) + (8 * GraphStruct::c_GraphFileHeader::s_targets), (header.file_size + 63) & ~(uint64_t)(63));
+	std::cout << "Damaged files rejected: target " << target << ", offsets " << offsets << ", section " << section << " (expected 1 1 1).\n";
+	failures += !target + !offsets + !section;
+
+	std::remove(test_path);
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
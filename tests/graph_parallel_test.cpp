@@ -0,0 +1,70 @@
+#define ERC_GRAPH_PARALLEL
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include "./AppliedConcepts/Graph.hpp"
+
+// Build with -pthread. Checks the multi-threaded Breadth-First traversal against the single-threaded one.
+
+// Builds a random graph with the specified number of nodes (IDs 1 to nodes) and connections.
+GraphStruct::c_Graph<uint32_t> makeGraph(uint32_t nodes, uint32_t connections, uint32_t seed) {
+	std::mt19937 rng(seed);
+	std::vector<GraphStruct::c_GraphCnt> cnts;
+	cnts.reserve(connections);
+	for (uint32_t i=0; i < connections; i++) {
+		cnts.push_back({(uint32_t)(rng() % nodes) + 1, (uint32_t)(rng() % nodes) + 1});
+	}
+	return GraphStruct::c_Graph<uint32_t>(0, cnts.begin(), cnts.end());
+}
+
+// Compares both parallel modes from one initial node with runBreadthFirst. The exact mode must give the same order; the
+// relaxed mode must give the same nodes, still level by level. The graph must have no more than @c nodes nodes. Returns
+// the number of failed checks.
+uint32_t checkFrom(GraphStruct::c_Graph<uint32_t>& graph, uint32_t nodes, uint32_t start, uint32_t threads) {
+	std::vector<uint32_t> levels;
+	const std::vector<GraphStruct::c_GraphNode<uint32_t>*> sequential = graph.runBreadthFirst(start, levels);
+	const std::vector<GraphStruct::c_GraphNode<uint32_t>*> exact = graph.runBreadthFirstParallel(start, threads);
+	std::vector<GraphStruct::c_GraphNode<uint32_t>*> relaxed = graph.runBreadthFirstParallel(start, threads, true);
+	// Every node reached by the relaxed mode must lie no nearer than the one before it.
+	std::vector<uint32_t> level_of(nodes, (uint32_t)(-1));
+	for (uint32_t i=0; i < sequential.size(); i++) {
+		level_of[sequential[i]->slot] = levels[i];
+	}
+	bool ordered = true;
+	for (uint32_t i=1; i < relaxed.size(); i++) {
+		ordered = ordered && (level_of[relaxed[i - 1]->slot] <= level_of[relaxed[i]->slot]);
+	}
+	std::vector<GraphStruct::c_GraphNode<uint32_t>*> expected = sequential;
+	std::sort(expected.begin(), expected.end());
+	std::sort(relaxed.begin(), relaxed.end());
+	const bool same_order = exact == sequential, same_set = relaxed == expected;
+	std::cout << "From " << start << " on " << threads << " threads: " << sequential.size() << " nodes, exact order "
+		<< (same_order ? "matches" : "DIFFERS") << ", relaxed set " << (same_set ? "matches" : "DIFFERS")
+		<< (ordered ? " level by level" : " OUT OF LEVEL ORDER") << '\n';
+	return !same_order + !same_set + !ordered;
+}
+
+int main() {
+	uint32_t failures = 0;
+	GraphStruct::c_Graph<uint32_t> small(0, {
+		{1, 2}, {1, 3}, {2, 4}, {3, 4}, {4, 5}, {5, 1}, {5, 6}, {6, 7}, {2, 7}, {8, 1}
+	});
+	for (uint32_t threads : {1, 2, 5}) {
+		failures += checkFrom(small, 8, 1, threads);
+	}
+	failures += checkFrom(small, 8, 8, 3);
+	std::cout << "From a missing node: " << small.runBreadthFirstParallel(99, 2).size() << " nodes (expected 0).\n";
+	failures += !small.runBreadthFirstParallel(99, 2).empty();
+
+	// Large enough for the frontiers to be split across the threads, and for the relaxed mode to expand bottom-up.
+	GraphStruct::c_Graph<uint32_t> large = makeGraph(1 << 17, 1 << 20, 6);
+	for (uint32_t threads : {0, 3, 8}) {
+		failures += checkFrom(large, 1 << 17, 1, threads);
+	}
+	// Sparse enough that a good part of the nodes are never reached.
+	GraphStruct::c_Graph<uint32_t> sparse = makeGraph(1 << 16, 1 << 17, 7);
+	failures += checkFrom(sparse, 1 << 16, 1, 4);
+
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,113 @@
+#define ERC_GRAPH_STATS
+#include <atomic>
+#include <iostream>
+#include <thread>
+#include "./AppliedConcepts/Graph.hpp"
+
+// Build with -pthread. Checks the traversal statistics recorded when ERC_GRAPH_STATS is defined, and their observer.
+
+// 1 to 4 form a cycle with two routes from 1 to 4; 5 and 6 point at each other, apart from the rest.
+GraphStruct::c_Graph<int> testgraph_stats(0, {
+	{1, 2}, {1, 3}, {2, 4}, {3, 4}, {4, 1},
+	{5, 6}, {6, 5}
+});
+
+std::atomic<uint32_t> reports(0);
+std::atomic<uint64_t> reported_nodes(0);
+
+// Counts every report, keeps the number of nodes of the last one, and passes the statistics on.
+void countReports(c_FuncHook_Shared<void, const GraphStruct::c_TraversalStats&>::c_Context next, const GraphStruct::c_TraversalStats& stats) {
+	reports++;
+	reported_nodes = stats.nodes_visited;
+	next.invoke(stats);
+}
+
+// Starts another (shorter) traversal from within the report of the first one, which is reported in turn.
+void nestedReport(c_FuncHook_Shared<void, const GraphStruct::c_TraversalStats&>::c_Context next, const GraphStruct::c_TraversalStats& stats) {
+	if (stats.nodes_visited == 4) {
+		testgraph_stats.runBreadthFirst(5);
+	}
+	next.invoke(stats);
+}
+
+int main() {
+	uint32_t failures = 0;
+	testgraph_stats.statsObserver().addHook(countReports);
+
+	// Level by level from 1: {1}, {2, 3}, {4}. Every connection is scanned once, and 4 and 1 are each found twice.
+	testgraph_stats.runBreadthFirst(1);
+	GraphStruct::c_TraversalStats stats = testgraph_stats.lastStats();
+	std::cout << "BFS from 1: " << stats.nodes_visited << " nodes, " << stats.edges_scanned << " connections, "
+		<< stats.visited_tests << " tests with " << stats.visitedHits() << " hits, frontiers";
+	for (uint32_t i : stats.frontier_sizes) {
+		std::cout << ' ' << i;
+	}
+	std::cout << " (expected 4 nodes, 5 connections, 6 tests with 2 hits, frontiers 1 2 1)\n";
+	failures += (stats.nodes_visited != 4) || (stats.edges_scanned != 5) || (stats.visited_tests != 6) || (stats.visitedHits() != 2);
+	failures += stats.frontier_sizes != std::vector<uint32_t>({1, 2, 1});
+	failures += (stats.hitRate() < 0.33) || (stats.hitRate() > 0.34);
+	std::cout << "Reported " << reports << " time(s) with " << reported_nodes << " nodes (expected 1 with 4).\n";
+	failures += (reports != 1) || (reported_nodes != 4);
+
+	// Depth-First traversals record the same counts, without frontiers.
+	std::vector<GraphStruct::c_GraphNode<int>*> output;
+	testgraph_stats.runDepthFirst(1, output, GraphStruct::e_DfsOrder::PostOrder);
+	stats = testgraph_stats.lastStats();
+	std::cout << "DFS from 1: " << stats.nodes_visited << " nodes, " << stats.edges_scanned << " connections (expected 4 and 5).\n";
+	failures += (stats.nodes_visited != 4) || (stats.edges_scanned != 5) || !stats.frontier_sizes.empty() || (reports != 2);
+
+	// A visitor that stops at once only visits the initial node, and a missing initial node is not recorded at all.
+	testgraph_stats.visitBreadthFirst(1, [](GraphStruct::c_GraphNode<int>*, GraphStruct::c_GraphNode<int>*) { return GraphStruct::e_Visit::Stop; });
+	testgraph_stats.runBreadthFirst(99);
+	stats = testgraph_stats.lastStats();
+	std::cout << "Stopped at once: " << stats.nodes_visited << " node, " << stats.edges_scanned << " connections, "
+		<< reports << " reports (expected 1, 0 and 3).\n";
+	failures += (stats.nodes_visited != 1) || (stats.edges_scanned != 0) || (reports != 3);
+
+	// A search header supplied by the caller collects the statistics too.
+	GraphStruct::c_SearchHeader<int> header;
+	std::vector<uint32_t> levels;
+	testgraph_stats.runBreadthFirst(5, levels, &header);
+	std::cout << "BFS from 5 with a header: " << header.stats.nodes_visited << " nodes, " << header.stats.visitedHits()
+		<< " hit (expected 2 and 1).\n";
+	failures += (header.stats.nodes_visited != 2) || (header.stats.edges_scanned != 2) || (header.stats.visitedHits() != 1);
+	failures += testgraph_stats.lastStats().nodes_visited != 2;
+
+	// An observer may start a traversal of its own, which is reported within the first report; the first traversal still
+	// ends last, so it is the one kept.
+	testgraph_stats.statsObserver().addHook(nestedReport);
+	const uint32_t before = reports;
+	testgraph_stats.runBreadthFirst(1);
+	std::cout << "Nested traversal: " << (reports - before) << " reports, last stats with " << testgraph_stats.lastStats().nodes_visited
+		<< " nodes (expected 2, last stats with 4).\n";
+	failures += (reports - before != 2) || (testgraph_stats.lastStats().nodes_visited != 4);
+	testgraph_stats.statsObserver().removeHook(nestedReport);
+
+	// Traversals on several threads at once each record whole statistics of their own.
+	std::atomic<uint32_t> mixed(0);
+	std::vector<std::thread> pool;
+	for (uint32_t t=0; t < 4; t++) {
+		pool.emplace_back([&mixed, t]() {
+			for (uint32_t i=0; i < 200; i++) {
+				testgraph_stats.runBreadthFirst((t & 1) ? 1 : 5);
+				const GraphStruct::c_TraversalStats seen = testgraph_stats.lastStats();
+				const bool whole = ((seen.nodes_visited == 4) && (seen.edges_scanned == 5)) || ((seen.nodes_visited == 2) && (seen.edges_scanned == 2));
+				mixed += !whole;
+			}
+		});
+	}
+	for (std::thread& i : pool) {
+		i.join();
+	}
+	std::cout << "Concurrent traversals: " << reports << " reports, " << mixed << " mixed statistics (expected " << (before + 802) << " and 0).\n";
+	failures += (reports != before + 802) || (mixed != 0);
+
+	// Once the observer is removed, the statistics are still recorded, but no longer reported.
+	testgraph_stats.statsObserver().removeHook(countReports);
+	const uint32_t removed = reports;
+	testgraph_stats.runDepthFirst(2);
+	failures += (reports != removed) || (testgraph_stats.lastStats().nodes_visited != 4);
+
+	std::cout << (failures ? "FAILED\n" : "All checks passed.\n");
+	return failures ? 1 : 0;
+}
@@ -46,6 +46,13 @@ int main() {
 		std::cout << i->index << ' ';
 	}
 	std::cout << '\n' << std::flush;
+	output_traversal.clear();
+	testgraph_lo.runDepthFirst(1, output_traversal, GraphStruct::e_DfsOrder::PostOrder);
+	std::cout << "Output (POST-ORDER) is size " << output_traversal.size() << '\n';
+	for (GraphStruct::c_GraphNode<uint8_t>* i : output_traversal) {
+		std::cout << i->index << ' ';
+	}
+	std::cout << '\n' << std::flush;
 	output_traversal = testgraph_lo.runBreadthFirst(1, filtfnc);
 	std::cout << "Output (FILTERED) is size " << output_traversal.size() << '\n';
 	for (GraphStruct::c_GraphNode<uint8_t>* i : output_traversal) {
@@ -65,5 +72,68 @@ int main() {
 		std::cout << i->index << ' ';
 	}
 	std::cout << '\n' << std::flush;
-	return 0;
+	uint32_t visited = 0;
+	bool finished = testgraph_hi.visitBreadthFirst(1, [&visited](GraphStruct::c_GraphNode<uint8_t>* /*last*/, GraphStruct::c_GraphNode<uint8_t>* current) {
+		std::cout << current->index << ' ';
+		visited++;
+		return (current->index == 10) ? GraphStruct::e_Visit::Stop : GraphStruct::e_Visit::Continue;
+	});
+	std::cout << "\nVisitor (STOP AT 10) saw " << visited << " nodes and " << (finished ? "finished" : "stopped early") << '\n' << std::flush;
+	
+	std::cout << "\nFrozen (CSR) graph traversals:\n";
+	const GraphStruct::c_GraphCSR<uint8_t>& frozen = testgraph_hi.freeze();
+	std::vector<uint32_t> frozen_traversal = frozen.traverseBfs(frozen.findSlot(1));
+	std::cout << "Output (BFS) is size " << frozen_traversal.size() << '\n';
+	for (uint32_t i : frozen_traversal) {
+		std::cout << frozen.ids[i] << ' ';
+	}
+	std::cout << '\n';
+	frozen_traversal = frozen.traverseDfs(frozen.findSlot(1));
+	std::cout << "Output (DFS) is size " << frozen_traversal.size() << '\n';
+	for (uint32_t i : frozen_traversal) {
+		std::cout << frozen.ids[i] << ' ';
+	}
+	std::cout << '\n' << std::flush;
+	
+	std::cout << "\nBulk-built (deduplicated) graph traversals:\n";
+	std::vector<GraphStruct::c_GraphCnt> edge_list = {{1, 2}, {1, 3}, {2, 4}, {1, 2}, {3, 3}, {3, 4}, {2, 4}, {4, 1}};
+	GraphStruct::c_Graph<uint8_t> testgraph_bulk(0, edge_list.begin(), edge_list.end(), true);
+	std::cout << "Connections kept: " << testgraph_bulk.viewConnections().size() << " of " << edge_list.size() << '\n';
+	output_traversal = testgraph_bulk.runBreadthFirst(1);
+	std::cout << "Output (STANDARD) is size " << output_traversal.size() << '\n';
+	for (GraphStruct::c_GraphNode<uint8_t>* i : output_traversal) {
+		std::cout << i->index << ' ';
+	}
+	std::cout << '\n' << std::flush;
+	testgraph_bulk.addEdges(0, {{4, 5}, {5, 6}, {4, 5}});
+	testgraph_bulk.removeNodes({2});
+	std::cout << "After adding 4-5-6 and removing node 2, connections: " << testgraph_bulk.viewConnections().size() << '\n';
+	output_traversal = testgraph_bulk.runBreadthFirst(1);
+	std::cout << "Output (STANDARD) is size " << output_traversal.size() << '\n';
+	for (GraphStruct::c_GraphNode<uint8_t>* i : output_traversal) {
+		std::cout << i->index << ' ';
+	}
+	std::cout << '\n' << std::flush;
+	
+	// Nodes linked in by hand from outside the graph hold no slot of it (or the slot of another graph), so they are
+	// neither looked up by slot nor taken for the 1-3 connection when the batch is deduplicated.
+	uint32_t failures = 0;
+	GraphStruct::c_Graph<uint8_t> testgraph_linked(0, {{1, 2}, {2, 3}}), testgraph_other(0, {{7, 8}, {8, 9}});
+	GraphStruct::c_GraphNode<uint8_t> loose(90, 0);
+	GraphStruct::c_GraphNode<uint8_t>* linked = testgraph_linked.findNode(1), * foreign = testgraph_other.findNode(9);
+	linked->establishCnt(&loose);
+	linked->establishCnt(foreign);
+	testgraph_linked.buildEdges(0, std::vector<GraphStruct::c_GraphCnt>({{1, 3}, {1, 2}}), true);
+	std::cout << "With outside nodes linked in, node 1 has " << linked->externalDegree() << " connections out and the graph "
+		<< testgraph_linked.viewConnections().size() << " (expected 4 and 3)\n";
+	failures += (linked->externalDegree() != 4) || (testgraph_linked.viewConnections().size() != 3);
+	// Removing a node unlinks the outside nodes connected to it as well, without touching the degrees of this graph.
+	loose.establishCnt(testgraph_linked.findNode(2));
+	testgraph_linked.removeNodes({2u});
+	std::cout << "After removing node 2, the graph has " << testgraph_linked.viewConnections().size() << " connections and the outside node "
+		<< loose.externalDegree() << " (expected 1 and 0)\n";
+	failures += (testgraph_linked.viewConnections().size() != 1) || (loose.externalDegree() != 0) || (linked->externalDegree() != 3);
+	linked->severCnt(&loose);
+	linked->severCnt(foreign);
+	return failures ? 1 : 0;
 }